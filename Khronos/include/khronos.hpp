@@ -14,7 +14,21 @@ Khronos library header.
 #include <khronos/julian_day.hpp>
 #include <khronos/timeofday.hpp>
 #include <khronos/gregorian_calendar.hpp>
+#include <khronos/gregorian_table.hpp>
 #include <khronos/julian_calendar.hpp>
 #include <khronos/islamic_calendar.hpp>
 #include <khronos/hebrew_calendar.hpp>
-#include <khronos/vulcan_calendar.hpp>
\ No newline at end of file
+#include <khronos/vulcan_calendar.hpp>
+#include <khronos/clock.hpp>
+#include <khronos/jd_exact.hpp>
+#include <khronos/packed_date.hpp>
+#include <khronos/format.hpp>
+#include <khronos/iso8601.hpp>
+#include <khronos/batch.hpp>
+#include <khronos/literals.hpp>
+#include <khronos/convert.hpp>
+#include <khronos/range.hpp>
+#include <khronos/workday.hpp>
+#include <khronos/recurrence.hpp>
+#include <khronos/hebrew_holidays.hpp>
+#include <khronos/ummalqura_calendar.hpp>
\ No newline at end of file
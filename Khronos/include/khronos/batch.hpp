@@ -0,0 +1,178 @@
+#pragma once
+
+/**	@file khronos/batch.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library batch (structure-of-arrays) conversion declarations.
+    Batch functions convert whole columns of dates per call, using AVX-512 or AVX2
+    when the processor supports them and a portable scalar loop otherwise.
+    Every batch function produces results bit-identical to its scalar counterpart.
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/gregorian_calendar.hpp>
+#include <khronos/hebrew_calendar.hpp>
+#include <khronos/islamic_calendar.hpp>
+#include <concepts>
+#include <cstdint>
+#include <span>
+
+
+namespace khronos {
+
+    namespace batch {
+
+        /** Instruction set used by the batch kernels. */
+        enum class Isa { scalar = 0, avx2, avx512 };
+
+        /** Returns the best instruction set supported by this processor (and compiled in). */
+        Isa detected_isa();
+
+        /** Returns the instruction set the batch kernels currently use. */
+        Isa active_isa();
+
+        /**	Selects the instruction set used by the batch kernels.
+            Requests beyond detected_isa() are lowered to detected_isa().
+            @return the instruction set actually selected.
+            */
+        Isa set_active_isa(Isa isa);
+
+        /** Returns the name of the instruction set as a c-string. */
+        constexpr char const* isa_name(Isa isa) {
+            switch (isa) {
+            case Isa::avx512: return "avx512";
+            case Isa::avx2: return "avx2";
+            default: return "scalar";
+            }
+        }
+
+
+
+        // --------------------------------------------------------------------------------------
+        // GREGORIAN
+        // --------------------------------------------------------------------------------------
+
+        /**	Converts columns of Gregorian dates to Julian Days (midnight).
+            @pre all spans have the same size.
+            @param out [out] out[i] == khronos::gregorian_to_jd(years[i], months[i], days[i])
+            */
+        void gregorian_to_jd(std::span<const year_t> years, std::span<const month_t> months, std::span<const day_t> days,
+            std::span<jd_t> out);
+
+        /**	Converts columns of Gregorian dates and times of day to Julian Days.
+            @pre all spans have the same size.
+            @param out [out] out[i] == khronos::gregorian_to_jd(years[i], months[i], days[i], hours[i], minutes[i], seconds[i])
+            */
+        void gregorian_to_jd(std::span<const year_t> years, std::span<const month_t> months, std::span<const day_t> days,
+            std::span<const hour_t> hours, std::span<const minute_t> minutes, std::span<const second_t> seconds,
+            std::span<jd_t> out);
+
+        /**	Decodes a column of Julian Days into columns of Gregorian dates.
+            @pre all spans have the same size.
+            @param jds [in] jds[i] is decoded as khronos::jd_to_gregorian(jds[i], years[i], months[i], days[i])
+            */
+        void jd_to_gregorian(std::span<const jd_t> jds,
+            std::span<year_t> years, std::span<month_t> months, std::span<day_t> days);
+
+        /**	Decodes a column of Julian Days into columns of Gregorian dates and times of day.
+            @pre all spans have the same size.
+            @param jds [in] jds[i] is decoded as khronos::jd_to_gregorian(jds[i], years[i], months[i], days[i], hours[i], minutes[i], seconds[i])
+            */
+        void jd_to_gregorian(std::span<const jd_t> jds,
+            std::span<year_t> years, std::span<month_t> months, std::span<day_t> days,
+            std::span<hour_t> hours, std::span<minute_t> minutes, std::span<second_t> seconds);
+
+        /**	Adds the same number of days to a column of Gregorian dates.
+            Times of day are unaffected and are not passed.  The output spans may be the input spans.
+            @pre all spans have the same size.
+            @param n [in] signed day offset
+            @param outYears [out] (outYears[i], outMonths[i], outDays[i]) == khronos::add_days(Gregorian(years[i], months[i], days[i]), n)
+            */
+        void add_days(std::span<const year_t> years, std::span<const month_t> months, std::span<const day_t> days,
+            std::int64_t n,
+            std::span<year_t> outYears, std::span<month_t> outMonths, std::span<day_t> outDays);
+
+
+
+        // --------------------------------------------------------------------------------------
+        // HEBREW
+        // --------------------------------------------------------------------------------------
+
+        /**	Decodes a column of Julian Days into columns of Hebrew dates.
+            Consecutive days of the same year share one year lookup, so calendar views cost a
+            few operations per day.
+            @pre all spans have the same size.
+            @param jds [in] jds[i] is decoded as khronos::jd_to_hebrew(jds[i], years[i], months[i], days[i])
+            */
+        void jd_to_hebrew(std::span<const jd_t> jds,
+            std::span<year_t> years, std::span<month_t> months, std::span<day_t> days);
+
+        /**	Decodes a column of Julian Days into columns of Hebrew dates and times of day.
+            @pre all spans have the same size.
+            @param jds [in] jds[i] is decoded as khronos::jd_to_hebrew(jds[i], years[i], months[i], days[i], hours[i], minutes[i], seconds[i])
+            */
+        void jd_to_hebrew(std::span<const jd_t> jds,
+            std::span<year_t> years, std::span<month_t> months, std::span<day_t> days,
+            std::span<hour_t> hours, std::span<minute_t> minutes, std::span<second_t> seconds);
+
+
+
+
+        // --------------------------------------------------------------------------------------
+        // ISLAMIC
+        // --------------------------------------------------------------------------------------
+
+        // The batch Islamic kernels are compiled for the four variants built from IslamicLeap15/16
+        // and IslamicCivilEpoch/IslamicAstronomicalEpoch; the defaults are those of Islamic.
+        // Other policies are rejected at compile time (the scalar functions accept them).
+        template <class LeapPattern, class Epoch>
+        concept BatchIslamicVariant = (std::same_as<LeapPattern, IslamicLeap16> || std::same_as<LeapPattern, IslamicLeap15>)
+            && (std::same_as<Epoch, IslamicCivilEpoch> || std::same_as<Epoch, IslamicAstronomicalEpoch>);
+
+        /**	Converts columns of Islamic dates to Julian Days (midnight of each date).
+            @pre all spans have the same size.
+            @param jds [out] jds[i] == khronos::islamic_to_jd<LeapPattern, Epoch>(years[i], months[i], days[i])
+            */
+        template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+            requires BatchIslamicVariant<LeapPattern, Epoch>
+        void islamic_to_jd(std::span<const year_t> years, std::span<const month_t> months, std::span<const day_t> days,
+            std::span<jd_t> jds);
+
+        /**	Decodes a column of Julian Days into columns of Islamic dates.
+            @pre all spans have the same size.
+            @param jds [in] jds[i] is decoded as khronos::jd_to_islamic<LeapPattern, Epoch>(jds[i], years[i], months[i], days[i])
+            */
+        template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+            requires BatchIslamicVariant<LeapPattern, Epoch>
+        void jd_to_islamic(std::span<const jd_t> jds,
+            std::span<year_t> years, std::span<month_t> months, std::span<day_t> days);
+
+        /**	Adds the same number of days to a column of Islamic dates.
+            Times of day are unaffected and are not passed.  The output spans may be the input spans.
+            @pre all spans have the same size.
+            @param n [in] signed day offset
+            @param outYears [out] (outYears[i], outMonths[i], outDays[i]) == khronos::add_days(IslamicTabular<LeapPattern, Epoch>(years[i], months[i], days[i]), n)
+            */
+        template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+            requires BatchIslamicVariant<LeapPattern, Epoch>
+        void islamic_add_days(std::span<const year_t> years, std::span<const month_t> months, std::span<const day_t> days,
+            std::int64_t n,
+            std::span<year_t> outYears, std::span<month_t> outMonths, std::span<day_t> outDays);
+
+        /**	Adds the same number of months to a column of Islamic dates.
+            Times of day are unaffected and are not passed.  The output spans may be the input spans.
+            @pre all spans have the same size.
+            @param n [in] signed month offset
+            @param outYears [out] (outYears[i], outMonths[i], outDays[i]) == khronos::add_months(IslamicTabular<LeapPattern, Epoch>(years[i], months[i], days[i]), n)
+            */
+        template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+            requires BatchIslamicVariant<LeapPattern, Epoch>
+        void islamic_add_months(std::span<const year_t> years, std::span<const month_t> months, std::span<const day_t> days,
+            std::int64_t n,
+            std::span<year_t> outYears, std::span<month_t> outMonths, std::span<day_t> outDays);
+
+    } // end-of-namespace batch
+
+} // end-of-namespace khronos
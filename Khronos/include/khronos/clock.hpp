@@ -0,0 +1,76 @@
+#pragma once
+
+/**	@file khronos/clock.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library wall-clock service.
+    Every 'now' constructor reads the time through this service.  A reading costs one
+    clock query (clock_gettime, served from the vDSO on Linux) plus integer arithmetic:
+    the local-time offset is computed at most once per second and shared lock-free by
+    all threads.  The clock source can be replaced, e.g. by a fixed clock in tests.
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <cstdint>
+
+
+namespace khronos {
+
+    namespace clock {
+
+        /** Julian Day Number of the Unix epoch, 1970-01-01. */
+        constexpr jdn_t UNIX_EPOCH_JDN = 2'440'588;
+
+        /** An instant of UTC time, as elapsed time since 1970-01-01 00:00:00 UTC. */
+        struct Instant {
+            std::int64_t seconds;           // Whole seconds (floor).
+            std::int32_t nanoseconds;       // [0..999'999'999]
+        };
+
+        /** Local civil date and time of day, to the whole second. */
+        struct LocalTime {
+            year_t year;
+            month_t month;
+            day_t day;
+            hour_t hour;
+            minute_t minute;
+            second_t second;
+        };
+
+        /** A source of wall-clock time. */
+        class Source {
+        public:
+            virtual ~Source() = default;
+
+            // Returns the current UTC instant.
+            virtual Instant now() const = 0;
+
+            // Returns local time minus UTC, in seconds, at the given UTC second.
+            virtual std::int32_t utc_offset(std::int64_t seconds) const = 0;
+        };
+
+        /** Returns the operating system's clock and time zone. */
+        Source const& system_source();
+
+        /**	Selects the clock source used by the service.
+            @param source [in] the new source, or nullptr for system_source(); it must outlive its use.
+            */
+        void set_source(Source const* source);
+
+        /** Returns the current UTC instant. */
+        Instant now();
+
+        /** Returns the current UTC time as a Julian Day, to sub-second resolution. */
+        jd_t utc_jd();
+
+        /** Returns the current local time as a Julian Day, to sub-second resolution. */
+        jd_t local_jd();
+
+        /** Returns the current local civil date and time, to the whole second. */
+        LocalTime local_time();
+
+    } // end-of-namespace clock
+
+} // end-of-namespace khronos
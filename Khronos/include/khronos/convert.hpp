@@ -0,0 +1,193 @@
+#pragma once
+
+/**	@file khronos/convert.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library cross-calendar conversion.
+    convert<To>(from) converts a date between calendar classes without going through a
+    floating-point Jd: the date travels as an integer day number and the time of day is
+    carried over unchanged.  The conversion is chosen at compile time from converter<To, From>,
+    which may be specialized for pairs that have a more direct kernel.
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/timeofday.hpp>
+#include <khronos/gregorian_calendar.hpp>
+#include <khronos/julian_calendar.hpp>
+#include <khronos/islamic_calendar.hpp>
+#include <khronos/hebrew_calendar.hpp>
+#include <khronos/ummalqura_calendar.hpp>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+
+
+namespace khronos {
+
+    /**	A date class of the library: date and time-of-day fields, construction from those
+        fields and conversion to a Jd.
+        */
+    template <class T>
+    concept Calendar = std::constructible_from<T, year_t, month_t, day_t, hour_t, minute_t, second_t>
+        && requires(T const& date) {
+            { date.year() } -> std::convertible_to<year_t>;
+            { date.month() } -> std::convertible_to<month_t>;
+            { date.day() } -> std::convertible_to<day_t>;
+            { date.hour() } -> std::convertible_to<hour_t>;
+            { date.minute() } -> std::convertible_to<minute_t>;
+            { date.second() } -> std::convertible_to<second_t>;
+            { static_cast<Jd>(date) };
+        };
+
+    /**	Integer day-number kernels of a calendar, used by convert() and range().
+        A specialization provides:
+            to_jdn(year, month, day)                    JDN of the date
+            from_jdn(jdn, year, month, day)             date of the JDN
+            DAY_BEGINS_AT_NOON                          true if a time of day >= 12:00 belongs to the previous civil day
+            FIRST_MONTH                                 month number the year begins with
+            days_in_month(year, month)                  length of the month
+            next_month(year, month)                     steps to the following month, in place
+            previous_month(year, month)                 steps to the preceding month, in place
+        */
+    template <class Calendar>
+    struct calendar_traits;
+
+    template <>
+    struct calendar_traits<Gregorian> {
+        static constexpr bool DAY_BEGINS_AT_NOON = false;
+        static constexpr month_t FIRST_MONTH = 1;
+        static constexpr jdn_t to_jdn(year_t year, month_t month, day_t day) { return gregorian_to_jdn(year, month, day); }
+        static constexpr void from_jdn(jdn_t jdn, year_t& year, month_t& month, day_t& day) {
+            if (std::is_constant_evaluated())
+                jdn_to_gregorian(jdn, year, month, day);
+            else
+                detail::jdn_to_gregorian_selected(jdn, year, month, day);
+        }
+        static constexpr day_t days_in_month(year_t year, month_t month) { return gregorian_days_in_month(month, is_gregorian_leapyear(year)); }
+        static constexpr void next_month(year_t& year, month_t& month) { if (++month > 12) { month = 1; ++year; } }
+        static constexpr void previous_month(year_t& year, month_t& month) { if (--month < 1) { month = 12; --year; } }
+    };
+
+    template <>
+    struct calendar_traits<Julian> {
+        static constexpr bool DAY_BEGINS_AT_NOON = false;
+        static constexpr month_t FIRST_MONTH = 1;
+        static constexpr jdn_t to_jdn(year_t year, month_t month, day_t day) { return julian_to_jdn(year, month, day); }
+        static constexpr void from_jdn(jdn_t jdn, year_t& year, month_t& month, day_t& day) { jdn_to_julian(jdn, year, month, day); }
+        static constexpr day_t days_in_month(year_t year, month_t month) { return julian_days_in_month(month, is_julian_leapyear(year)); }
+        static constexpr void next_month(year_t& year, month_t& month) { if (++month > 12) { month = 1; ++year; } }
+        static constexpr void previous_month(year_t& year, month_t& month) { if (--month < 1) { month = 12; --year; } }
+    };
+
+    template <class LeapPattern, class Epoch>
+    struct calendar_traits<IslamicTabular<LeapPattern, Epoch>> {
+        static constexpr bool DAY_BEGINS_AT_NOON = true;
+        static constexpr month_t FIRST_MONTH = 1;
+        static constexpr jdn_t to_jdn(year_t year, month_t month, day_t day) { return islamic_to_jdn<LeapPattern, Epoch>(year, month, day); }
+        static constexpr void from_jdn(jdn_t jdn, year_t& year, month_t& month, day_t& day) { jdn_to_islamic<LeapPattern, Epoch>(jdn, year, month, day); }
+        static constexpr day_t days_in_month(year_t year, month_t month) { return static_cast<day_t>(islamic_month_length<LeapPattern, Epoch>(year, month)); }
+        static constexpr void next_month(year_t& year, month_t& month) { if (++month > 12) { month = 1; ++year; } }
+        static constexpr void previous_month(year_t& year, month_t& month) { if (--month < 1) { month = 12; --year; } }
+    };
+
+    template <>
+    struct calendar_traits<UmmAlQura> {
+        static constexpr bool DAY_BEGINS_AT_NOON = true;
+        static constexpr month_t FIRST_MONTH = 1;
+        static jdn_t to_jdn(year_t year, month_t month, day_t day) { return ummalqura_to_jdn(year, month, day); }
+        static void from_jdn(jdn_t jdn, year_t& year, month_t& month, day_t& day) { jdn_to_ummalqura(jdn, year, month, day); }
+        static day_t days_in_month(year_t year, month_t month) { return ummalqura_days_in_month(year, month); }
+        static constexpr void next_month(year_t& year, month_t& month) { if (++month > 12) { month = 1; ++year; } }
+        static constexpr void previous_month(year_t& year, month_t& month) { if (--month < 1) { month = 12; --year; } }
+    };
+
+    template <>
+    struct calendar_traits<Hebrew> {
+        static constexpr bool DAY_BEGINS_AT_NOON = true;
+        static constexpr month_t FIRST_MONTH = Tishri;
+        static constexpr jdn_t to_jdn(year_t year, month_t month, day_t day) { return hebrew_to_jdn(year, month, day); }
+        static constexpr void from_jdn(jdn_t jdn, year_t& year, month_t& month, day_t& day) { jdn_to_hebrew(jdn, year, month, day); }
+        static constexpr day_t days_in_month(year_t year, month_t month) { return hebrew_year_info(year).days_in_month(month); }
+
+        // The year runs Tishri (7) .. Adar (12), Veadar (13, leap years only), Nisan (1) .. Elul (6).
+        static constexpr void next_month(year_t& year, month_t& month) {
+            if (month == Elul) { month = Tishri; ++year; }
+            else if (month == Adar) month = is_hebrew_leapyear(year) ? Veadar : Nisan;
+            else if (month == Veadar) month = Nisan;
+            else ++month;
+        }
+        static constexpr void previous_month(year_t& year, month_t& month) {
+            if (month == Tishri) { month = Elul; --year; }
+            else if (month == Nisan) month = is_hebrew_leapyear(year) ? Veadar : Adar;
+            else --month;
+        }
+    };
+
+    /** A calendar whose dates convert through integer day numbers. */
+    template <class T>
+    concept DayNumberCalendar = Calendar<T> && requires(year_t& year, month_t& month, day_t& day) {
+        { calendar_traits<T>::to_jdn(year, month, day) } -> std::convertible_to<jdn_t>;
+        calendar_traits<T>::from_jdn(jdn_t{}, year, month, day);
+        { calendar_traits<T>::DAY_BEGINS_AT_NOON } -> std::convertible_to<bool>;
+    };
+
+
+
+    /**	Converts dates of calendar From to calendar To.
+        The primary template goes through the JDN of the civil day (midnight to midnight)
+        holding the instant, or through a Jd for calendars without day-number kernels.
+        */
+    template <Calendar To, Calendar From>
+    struct converter {
+        static constexpr To convert(From const& date) {
+            if constexpr (DayNumberCalendar<To> && DayNumberCalendar<From>) {
+                bool const afternoon = tod(date.hour(), date.minute(), date.second()) >= 0.5;
+                jdn_t jdn = calendar_traits<From>::to_jdn(date.year(), date.month(), date.day());
+                if constexpr (calendar_traits<From>::DAY_BEGINS_AT_NOON)
+                    jdn -= afternoon;
+                if constexpr (calendar_traits<To>::DAY_BEGINS_AT_NOON)
+                    jdn += afternoon;
+
+                year_t year{};
+                month_t month{};
+                day_t day{};
+                calendar_traits<To>::from_jdn(jdn, year, month, day);
+                return To(year, month, day, date.hour(), date.minute(), date.second());
+            }
+            else {
+                return To(static_cast<Jd>(date));
+            }
+        }
+    };
+
+
+
+    /**	Converts a date to another calendar.
+        The date is the one holding the same instant; the time of day is carried over exactly.
+        Years are astronomical in every calendar.
+        @param date [in] the date to convert.
+        */
+    template <Calendar To, Calendar From>
+    constexpr To convert(From const& date) {
+        if constexpr (std::is_same_v<To, From>)
+            return date;
+        else
+            return converter<To, From>::convert(date);
+    }
+
+    /**	Converts a column of dates to another calendar.
+        @pre dates.size() == out.size()
+        @param out [out] out[i] == convert<To>(dates[i])
+        */
+    template <Calendar To, Calendar From>
+    void convert(std::span<From const> dates, std::span<To> out) {
+        assert(dates.size() == out.size());
+        for (std::size_t i = 0; i < dates.size(); ++i)
+            out[i] = convert<To>(dates[i]);
+    }
+
+} // end-of-namespace khronos
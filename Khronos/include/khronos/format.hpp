@@ -0,0 +1,50 @@
+#pragma once
+
+/**	@file khronos/format.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library allocation-free formatting declarations.
+    format_to writes the same characters as the class's to_string() into a caller-supplied
+    buffer, without touching the heap or the iostream machinery.
+    */
+
+#include <khronos/julian_day.hpp>
+#include <khronos/gregorian_calendar.hpp>
+#include <khronos/julian_calendar.hpp>
+#include <khronos/hebrew_calendar.hpp>
+#include <khronos/jd_exact.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+
+
+namespace khronos {
+
+    /** Buffer size sufficient for the formatted form of any date. */
+    constexpr std::size_t FORMAT_BUFFER_SIZE = 128;
+
+    /**	Formats a date into the buffer [first, last).
+        Characters that do not fit are dropped; no terminating null is written.
+        @return one past the last character written.
+        @param first [in] start of the output buffer
+        @param last [in] end of the output buffer
+        @param value [in] the date; the output matches value.to_string()
+        */
+    char* format_to(char* first, char* last, Jd const& value);
+    char* format_to(char* first, char* last, Gregorian const& value);
+    char* format_to(char* first, char* last, Julian const& value);
+    char* format_to(char* first, char* last, Hebrew const& value);
+    char* format_to(char* first, char* last, JdExact const& value);
+
+    /**	Formats a date to an output iterator.
+        @return the iterator one past the last character written.
+        */
+    template <class OutputIt, class T>
+        requires std::output_iterator<OutputIt, char>
+    OutputIt format_to(OutputIt out, T const& value) {
+        char buffer[FORMAT_BUFFER_SIZE];
+        return std::copy(buffer, format_to(buffer, buffer + FORMAT_BUFFER_SIZE, value), out);
+    }
+
+} // end-of-namespace khronos
@@ -14,8 +14,12 @@ Khronos library 'Gregorian calendar' declarations.
 #include <khronos/def.hpp>
 #include <khronos/calendar.hpp>
 #include <khronos/julian_day.hpp>
+#include <khronos/clock.hpp>
+#include <khronos/gregorian_table.hpp>
+#include <algorithm>
 #include <string>
 #include <ctime>
+#include <type_traits>
 
 
 enum Month {
@@ -77,22 +81,20 @@ namespace khronos {
 
         Gregorian(); // Default constructor.
         Gregorian(Jd jd); // Constructor from Julian Day.
-        operator Jd() const; // Conversion to Julian Day.
+        constexpr operator Jd() const; // Conversion to Julian Day.
 
         // Initializes the current date, optionally including time of day.
         explicit Gregorian(now_t option) {
-            time_t utcTime = time(NULL);
-            struct tm tmLocal;
-            localtime_s(&tmLocal, &utcTime);
+            clock::LocalTime const now = clock::local_time();
 
-            year_ = year_t(tmLocal.tm_year) + 1900;
-            month_ = static_cast<Month>(tmLocal.tm_mon + 1);
-            day_ = day_t(tmLocal.tm_mday);
+            year_ = now.year;
+            month_ = static_cast<Month>(now.month);
+            day_ = now.day;
 
             if (option == WTIMEOFDAY) {
-                hour_ = hour_t(tmLocal.tm_hour);
-                minute_ = minute_t(tmLocal.tm_min);
-                second_ = second_t(tmLocal.tm_sec);
+                hour_ = now.hour;
+                minute_ = now.minute;
+                second_ = now.second;
             }
         }
 
@@ -130,6 +132,50 @@ namespace khronos {
 
 
 
+    /** Supported year range of the integer Gregorian <-> JDN kernels.
+        Every year in [GREGORIAN_JDN_MIN_YEAR..GREGORIAN_JDN_MAX_YEAR] (astronomical numbering)
+        maps to a JDN that fits in jdn_t without intermediate overflow.
+        */
+    constexpr year_t GREGORIAN_JDN_MAX_YEAR = 10'000'000'000'000'000;
+    constexpr year_t GREGORIAN_JDN_MIN_YEAR = -GREGORIAN_JDN_MAX_YEAR;
+
+    /**	Converts a proleptic Gregorian date to its Julian Day Number using integer arithmetic only.
+        @return the JDN of the day (JD of midnight + 0.5).
+        @param year [in] astronomical year [GREGORIAN_JDN_MIN_YEAR..GREGORIAN_JDN_MAX_YEAR]
+        @param month [in] month number [1..12]
+        @param day [in] day of the month [1..31]
+        */
+    constexpr jdn_t gregorian_to_jdn(year_t year, month_t month, day_t day) {
+        // Shift to a March-based year so that the leap day falls at the end of the year.
+        year_t const y = month <= 2 ? year - 1 : year;
+        jdn_t const era = (y >= 0 ? y : y - 399) / 400;                  // 400-year cycle (floored).
+        jdn_t const yoe = y - era * 400;                                  // [0..399]
+        jdn_t const mp = month > 2 ? month - 3 : month + 9;               // [0..11], March = 0
+        jdn_t const doy = (153 * mp + 2) / 5 + day - 1;                   // [0..365]
+        jdn_t const doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;          // [0..146096]
+        return era * 146'097 + doe + 1'721'120;
+    }
+
+    /**	Converts a Julian Day Number to a proleptic Gregorian date using integer arithmetic only.
+        @param jdn [in] Julian Day Number of any day in the supported year range.
+        @param year [out] astronomical year
+        @param month [out] month number [1..12]
+        @param day [out] day of the month [1..31]
+        */
+    constexpr void jdn_to_gregorian(jdn_t jdn, year_t& year, month_t& month, day_t& day) {
+        jdn_t const z = jdn - 1'721'120;                                  // days since 0000-03-01
+        jdn_t const era = (z >= 0 ? z : z - 146'096) / 146'097;           // 400-year cycle (floored).
+        jdn_t const doe = z - era * 146'097;                              // [0..146096]
+        jdn_t const yoe = (doe - doe / 1'460 + doe / 36'524 - doe / 146'096) / 365;  // [0..399]
+        jdn_t const doy = doe - (365 * yoe + yoe / 4 - yoe / 100);       // [0..365]
+        jdn_t const mp = (5 * doy + 2) / 153;                             // [0..11], March = 0
+        day = static_cast<day_t>(doy - (153 * mp + 2) / 5 + 1);
+        month = static_cast<month_t>(mp < 10 ? mp + 3 : mp - 9);
+        year = static_cast<year_t>(yoe + era * 400 + (month <= 2));
+    }
+
+
+
     // Computes the day of the week for a given Gregorian date.
     constexpr DayOfWeek day_of_week(const Gregorian& date) {
         auto y = date.year();
@@ -163,6 +209,9 @@ namespace khronos {
 
         return static_cast<DayOfWeek>((dow + 6) % 7);
     }
+
+    // Returns the name of the day for the given day of the week.
+    const char* day_name(DayOfWeek dow);
   
 
     
@@ -213,23 +262,16 @@ namespace khronos {
         return add_months(date, -month_t(m.value));
     }
 
-    // Adds a number of days to a given Gregorian date.
-    constexpr Gregorian add_days(Gregorian const& date, unsigned n) {
-        auto y = date.year();
-        unsigned m = date.month();
-        auto d = date.day() + n;
-
-        auto dom = gregorian_days_in_month(m, is_gregorian_leapyear(y));
-        while (d > static_cast<int>(dom)) {
-            d -= dom;
-            if (++m > 12) {
-                ++y;
-                m = 1;
-            }
-            dom = gregorian_days_in_month(m, is_gregorian_leapyear(y));
-        }
-
-        return Gregorian(y, Month(m), d);
+    /**	Adds a number of days to a given Gregorian date in constant time.
+        @param n [in] signed day offset; the result must stay within the JDN kernels' year range.
+        @return the shifted date, with the time of day unchanged.
+        */
+    constexpr Gregorian add_days(Gregorian const& date, std::int64_t n) {
+        year_t y;
+        month_t m;
+        day_t d;
+        jdn_to_gregorian(gregorian_to_jdn(date.year(), date.month(), date.day()) + n, y, m, d);
+        return Gregorian(y, m, d, date.hour(), date.minute(), date.second());
     }
 
     // Adds years to a Gregorian date, adjusting for leap years.
@@ -263,18 +305,54 @@ namespace khronos {
     constexpr minute_t minute(const Gregorian& g) { return g.minute(); }
     constexpr second_t second(const Gregorian& g) { return g.second(); }
 
-    
-    jd_t gregorian_to_jd(year_t year, month_t month, day_t day);
-    jd_t gregorian_to_jd(year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second);
-    void jd_to_gregorian(jd_t jd, year_t& year, month_t& month, day_t& day);
-    void jd_to_gregorian(jd_t jd, year_t& year, month_t& month, day_t& day, hour_t& hour, minute_t& minute, second_t& second);
-    jd_t jd_to_jdn(jd_t jd);
+
+    // Converts a Gregorian date to the Julian Day of its midnight.
+    constexpr jd_t gregorian_to_jd(year_t year, month_t month, day_t day) {
+        // The JD of midnight is half a day before the (noon-based) day number.
+        return static_cast<jd_t>(gregorian_to_jdn(year, month, day)) - 0.5;
+    }
+
+    // Converts a Gregorian date and time of day to a Julian Day.
+    constexpr jd_t gregorian_to_jd(year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second) {
+        return gregorian_to_jd(year, month, day) + (hour * 3600.0 + minute * 60.0 + second) / 86400.0;
+    }
+
+    // Converts a Julian Day to a Gregorian date; at run time the decoder selected by set_gregorian_decoder() is used.
+    constexpr void jd_to_gregorian(jd_t jd, year_t& year, month_t& month, day_t& day) {
+        jdn_t const jdn = utility::ifloor(jd + 0.5);
+        if (std::is_constant_evaluated())
+            jdn_to_gregorian(jdn, year, month, day);
+        else
+            detail::jdn_to_gregorian_selected(jdn, year, month, day);
+    }
+
+    // Converts a Julian Day to a Gregorian date and time of day (to the nearest second).
+    constexpr void jd_to_gregorian(jd_t jd, year_t& year, month_t& month, day_t& day, hour_t& hour, minute_t& minute, second_t& second) {
+        jdn_t const jdn = utility::ifloor(jd + 0.5);
+        jd_to_gregorian(jd, year, month, day);
+
+        // Seconds since midnight, rounded and kept within the day.
+        int const total_seconds = std::min(static_cast<int>(utility::ifloor((jd + 0.5 - jdn) * 86400.0 + 0.5)), 86399);
+        hour = total_seconds / 3600;
+        minute = (total_seconds % 3600) / 60;
+        second = total_seconds % 60;
+    }
+
+    // Rounds a Julian Day to the Julian Day Number of the day containing it.
+    constexpr jd_t jd_to_jdn(jd_t jd) {
+        return static_cast<jd_t>(utility::ifloor(jd + 0.5));
+    }
+
+    // Conversion operator from Gregorian to Julian Day.
+    constexpr Gregorian::operator Jd() const {
+        return Jd(gregorian_to_jd(year_, month_, day_, hour_, minute_, second_));
+    }
 
     // Overloads the - operator to compute the difference in days between two dates.
     inline int operator-(const Gregorian& lhs, const Gregorian& rhs) {
-        jd_t lhs_jd = gregorian_to_jd(lhs.year(), lhs.month(), lhs.day());
-        jd_t rhs_jd = gregorian_to_jd(rhs.year(), rhs.month(), rhs.day());
-        return static_cast<int>(lhs_jd - rhs_jd);
+        jdn_t lhs_jdn = gregorian_to_jdn(lhs.year(), lhs.month(), lhs.day());
+        jdn_t rhs_jdn = gregorian_to_jdn(rhs.year(), rhs.month(), rhs.day());
+        return static_cast<int>(lhs_jdn - rhs_jdn);
     }
 
    
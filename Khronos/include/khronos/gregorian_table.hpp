@@ -0,0 +1,108 @@
+#pragma once
+
+/**	@file khronos/gregorian_table.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library table-driven Gregorian decoder.
+    The 146,097-day (400-year) Gregorian cycle is compressed at compile time into year-start and
+    month-start offsets plus coarse bucket indices, so that a JDN decodes with one cycle division,
+    two table lookups and two compares.
+
+    jd_to_gregorian() uses the decoder selected by set_gregorian_decoder(); the initial choice is
+    the arithmetic decoder, or the table decoder when KHRONOS_GREGORIAN_TABLE_DECODER is defined.
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <array>
+#include <cstdint>
+
+
+namespace khronos {
+
+    /** Algorithms that decode a JDN to a Gregorian date. */
+    enum class GregorianDecoder { arithmetic = 0, table };
+
+    /** Returns the decoder used by jd_to_gregorian(). */
+    GregorianDecoder gregorian_decoder();
+
+    /**	Selects the decoder used by jd_to_gregorian().
+        @return the previously selected decoder.
+        */
+    GregorianDecoder set_gregorian_decoder(GregorianDecoder decoder);
+
+    namespace detail {
+        /** Converts a JDN to a Gregorian date with the selected decoder (the run-time path of jd_to_gregorian). */
+        void jdn_to_gregorian_selected(jdn_t jdn, year_t& year, month_t& month, day_t& day);
+    }
+
+
+
+    namespace gregorian_table {
+        constexpr std::int64_t CYCLE_DAYS = 146'097;     // days in 400 Gregorian years
+        constexpr int YEAR_BUCKET_SHIFT = 8;             // 256-day buckets: shorter than a year, so at most one year starts in each.
+        constexpr int MONTH_BUCKET_SHIFT = 4;            // 16-day buckets: shorter than a month.
+
+        /** Offsets within the cycle; years and months start on March 1 (March = month 0). */
+        struct Tables {
+            std::array<std::uint32_t, 401> yearStart{};                                     // day of the cycle each year starts on; [400] == CYCLE_DAYS
+            std::array<std::uint16_t, (CYCLE_DAYS >> YEAR_BUCKET_SHIFT) + 1> yearOfBucket{}; // year containing the first day of each bucket
+            std::array<std::uint16_t, 13> monthStart{};                                     // day of the year each month starts on; [12] == 366
+            std::array<std::uint8_t, (366 >> MONTH_BUCKET_SHIFT) + 1> monthOfBucket{};       // month containing the first day of each bucket
+        };
+
+        constexpr Tables make_tables() {
+            Tables t;
+            for (std::uint32_t y = 0; y <= 400; ++y)
+                t.yearStart[y] = 365 * y + y / 4 - y / 100 + y / 400;
+            std::uint16_t year = 0;
+            for (std::uint32_t b = 0; b < t.yearOfBucket.size(); ++b) {
+                while (t.yearStart[year + 1] <= b << YEAR_BUCKET_SHIFT)
+                    ++year;
+                t.yearOfBucket[b] = year;
+            }
+
+            constexpr std::uint16_t MONTH_DAYS[12] = { 31, 30, 31, 30, 31, 31, 30, 31, 30, 31, 31, 29 };
+            for (int m = 0; m < 12; ++m)
+                t.monthStart[m + 1] = t.monthStart[m] + MONTH_DAYS[m];
+            std::uint8_t month = 0;
+            for (std::uint32_t b = 0; b < t.monthOfBucket.size(); ++b) {
+                while (t.monthStart[month + 1] <= b << MONTH_BUCKET_SHIFT)
+                    ++month;
+                t.monthOfBucket[b] = month;
+            }
+            return t;
+        }
+
+        inline constexpr Tables TABLES = make_tables();
+    }
+
+
+
+    /**	Converts a Julian Day Number to a Gregorian date using the cycle tables.
+        Results are identical to jdn_to_gregorian().
+        @param jdn [in] Julian Day Number
+        @param year [out] astronomical year
+        @param month [out] month number [1..12]
+        @param day [out] day of the month [1..31]
+        */
+    constexpr void jdn_to_gregorian_table(jdn_t jdn, year_t& year, month_t& month, day_t& day) {
+        using namespace gregorian_table;
+        jdn_t const z = jdn - 1'721'120;                                  // days since 0000-03-01
+        jdn_t const era = (z >= 0 ? z : z - (CYCLE_DAYS - 1)) / CYCLE_DAYS;
+        auto const doe = static_cast<std::uint32_t>(z - era * CYCLE_DAYS); // [0..146096]
+
+        std::uint32_t yoe = TABLES.yearOfBucket[doe >> YEAR_BUCKET_SHIFT];
+        yoe += doe >= TABLES.yearStart[yoe + 1];
+        std::uint32_t const doy = doe - TABLES.yearStart[yoe];           // [0..365]
+
+        std::uint32_t mp = TABLES.monthOfBucket[doy >> MONTH_BUCKET_SHIFT];
+        mp += doy >= TABLES.monthStart[mp + 1];
+
+        day = static_cast<day_t>(doy - TABLES.monthStart[mp] + 1);
+        month = static_cast<month_t>(mp < 10 ? mp + 3 : mp - 9);
+        year = static_cast<year_t>(yoe + era * 400 + (month <= 2));
+    }
+
+} // end-of-namespace khronos
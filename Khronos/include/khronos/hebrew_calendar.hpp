@@ -9,9 +9,11 @@
 
 
 
+#include <array>
 #include <iostream>
 #include <cmath>
 #include <string>
+#include <type_traits>
 #include "khronos/def.hpp"  
 #include <khronos/julian_day.hpp>
 #include<khronos/gregorian_calendar.hpp>
@@ -28,7 +30,8 @@ namespace khronos {
 
     // Determines if the given Hebrew year is a leap year.
     constexpr bool is_hebrew_leapyear(year_t year) {
-        return (year * 7 + 1) % 19 < 7;
+        year_t const cycle = (year * 7 + 1) % 19;
+        return (cycle < 0 ? cycle + 19 : cycle) < 7;
     }
 
     // Returns the number of months in the given Hebrew year.
@@ -36,9 +39,9 @@ namespace khronos {
         return is_hebrew_leapyear(year) ? 13 : 12;
     }
 
-    // Retrieves the name of the given Hebrew month as a string.
-    inline std::string hebrew_month_name(HebrewMonth month) {
-        static const std::string names[] = {
+    // Retrieves the name of the given Hebrew month as a c-string.
+    constexpr char const* hebrew_month_name_c_str(month_t month) {
+        constexpr char const* const names[] = {
             "", "Nisan", "Iyyar", "Sivan", "Tammuz",
             "Av", "Elul", "Tishri", "Heshvan",
             "Kislev", "Teveth", "Shevat", "Adar", "Veadar"
@@ -46,6 +49,11 @@ namespace khronos {
         return (month >= Nisan && month <= Veadar) ? names[month] : "Invalid month";
     }
 
+    // Retrieves the name of the given Hebrew month as a string.
+    inline std::string hebrew_month_name(HebrewMonth month) {
+        return hebrew_month_name_c_str(month);
+    }
+
     // Converts a generic month_t to a Hebrew month name.
     inline std::string hebrew_month_name(month_t month) {
         return hebrew_month_name(static_cast<HebrewMonth>(month));
@@ -57,13 +65,218 @@ namespace khronos {
     double hebrew_days_in_year(year_t year);
     day_t hebrew_days_in_month(year_t year, month_t month);
 
-    // Converts a Hebrew date to Julian Day Number (JDN).
-    double hebrew_to_jd(year_t year, month_t month, day_t day);
-    double hebrew_to_jd(year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second);
+    namespace detail {
+        // Number of days in a Hebrew month given the shape of its year.
+        constexpr day_t hebrew_month_length(month_t month, bool leap, bool heshvanLong, bool kislevShort) {
+            if (month == 2 || month == 4 || month == 6 || month == 10 || month == 13) return 29;
+            if (month == 12 && !leap) return 29;
+            if (month == 8 && !heshvanLong) return 29;
+            if (month == 9 && kislevShort) return 29;
+            return 30;
+        }
+
+        // Offsets of the first day of each month from 1 Tishri, for each of the eight year shapes
+        // indexed by [leap * 4 + heshvanLong * 2 + kislevShort][month].
+        using HebrewMonthStarts = std::array<std::array<day_t, 14>, 8>;
+        constexpr HebrewMonthStarts make_hebrew_month_starts() {
+            HebrewMonthStarts starts{};
+            for (int shape = 0; shape < 8; ++shape) {
+                bool const leap = (shape & 4) != 0;
+                bool const heshvanLong = (shape & 2) != 0;
+                bool const kislevShort = (shape & 1) != 0;
+                day_t offset = 0;
+                for (month_t m = 7; m <= (leap ? 13 : 12); ++m) {
+                    starts[shape][m] = offset;
+                    offset += hebrew_month_length(m, leap, heshvanLong, kislevShort);
+                }
+                if (!leap)
+                    starts[shape][13] = offset;
+                for (month_t m = 1; m < 7; ++m) {
+                    starts[shape][m] = offset;
+                    offset += hebrew_month_length(m, leap, heshvanLong, kislevShort);
+                }
+            }
+            return starts;
+        }
+        inline constexpr HebrewMonthStarts HEBREW_MONTH_STARTS = make_hebrew_month_starts();
+    }
+
+    /**	Everything about a Hebrew year needed to convert its dates.
+        Obtained from hebrew_year_info(), which computes each year once and caches it.
+        */
+    struct HebrewYearInfo {
+        year_t  year;       // Hebrew year.
+        jdn_t   tishri1;    // Julian Day Number of 1 Tishri.
+        day_t   length;     // Number of days in the year.
+        bool    leap;       // True if the year has 13 months.
+
+        // Index of the year's shape in detail::HEBREW_MONTH_STARTS.
+        constexpr int shape() const {
+            return (leap ? 4 : 0) + (length % 10 == 5 ? 2 : 0) + (length % 10 == 3 ? 1 : 0);
+        }
+
+        // Number of months in the year.
+        constexpr month_t months_in_year() const { return leap ? 13 : 12; }
+
+        // Number of days in the given month.
+        constexpr day_t days_in_month(month_t month) const {
+            return detail::hebrew_month_length(month, leap, length % 10 == 5, length % 10 == 3);
+        }
+
+        // Offset of the first day of the given month from 1 Tishri.
+        constexpr day_t month_start(month_t month) const {
+            return detail::HEBREW_MONTH_STARTS[shape()][month];
+        }
+
+        // Julian Day Number of the given day of the year.
+        constexpr jdn_t jdn(month_t month, day_t day) const {
+            return tishri1 + month_start(month) + day - 1;
+        }
+
+        /**	Finds the month and day of a day of the year in constant time.
+            Every month has 29 or 30 days, so offset / 30 is the month's position in
+            year order or the position before it.
+            @param offset [in] days since 1 Tishri, in [0..length).
+            */
+        constexpr void month_day(day_t offset, month_t& month, day_t& day) const {
+            month_t const count = months_in_year();
+            month_t const fromTishri = count - 6;  // Tishri .. Adar (or Veadar)
+            auto const month_at = [fromTishri](int position) -> month_t {
+                return position < fromTishri ? position + 7 : position - fromTishri + 1;
+            };
+
+            int position = offset / 30;
+            if (position + 1 < count && month_start(month_at(position + 1)) <= offset)
+                ++position;
+
+            month = month_at(position);
+            day = offset - month_start(month) + 1;
+        }
+    };
+
+    namespace detail {
+        // JDN of 1 Tishri when both start-of-year delays are zero (HEBREW_EPOCH + 2.5).
+        constexpr jdn_t HEBREW_TISHRI1_BASE = 347'998;
+
+        // Floor division by a positive divisor.
+        constexpr long long floor_div(long long a, long long b) {
+            return a / b - (a % b < 0 ? 1 : 0);
+        }
+
+        // Remainder of floor division by a positive divisor.
+        constexpr long long floor_mod(long long a, long long b) {
+            return a - floor_div(a, b) * b;
+        }
+
+        // Days from the epoch to the molad of Tishri, postponed by the day-of-week rule.
+        constexpr long long delay_of_week(year_t year) {
+            long long const months = floor_div(235 * year - 234, 19);  // Moon cycles.
+            long long const parts = 12084 + 13753 * months;  // Parts calculation.
+            long long days = months * 29 + floor_div(parts, 25920);  // Total days.
 
-    // Converts a Julian Day Number (JDN) to a Hebrew date.
-    void jd_to_hebrew(jd_t jd, year_t& year, month_t& month, day_t& day);
-    void jd_to_hebrew(jd_t jd, year_t& year, month_t& month, day_t& day, hour_t& hour, minute_t& minute, second_t& second);
+            if (floor_mod(3 * (days + 1), 7) < 3)  // Adjust if required.
+                days += 1;
+
+            return days;
+        }
+
+        // Postponement that keeps the length of adjacent years legal.
+        constexpr long long delay_adjacent_year(long long last, long long present, long long next) {
+            if (next - present == 356) return 2;  // Long year adjustment.
+            if (present - last == 382) return 1;  // Short year adjustment.
+            return 0;
+        }
+
+        // Computes the year information from the molad arithmetic.
+        constexpr HebrewYearInfo compute_hebrew_year_info(year_t year) {
+            long long const d0 = delay_of_week(year - 1);
+            long long const d1 = delay_of_week(year);
+            long long const d2 = delay_of_week(year + 1);
+            long long const d3 = delay_of_week(year + 2);
+
+            jdn_t const tishri1 = HEBREW_TISHRI1_BASE + d1 + delay_adjacent_year(d0, d1, d2);
+            jdn_t const nextTishri1 = HEBREW_TISHRI1_BASE + d2 + delay_adjacent_year(d1, d2, d3);
+
+            return { year, tishri1, static_cast<day_t>(nextTishri1 - tishri1), is_hebrew_leapyear(year) };
+        }
+
+        // Returns the year information from a bounded, thread-safe cache whose reads never take a lock.
+        HebrewYearInfo cached_hebrew_year_info(year_t year);
+    }
+
+    /**	Returns the year information of a Hebrew year.
+        At run time it is served from the year cache; in a constant expression it is computed directly.
+        @param year [in] Hebrew year.
+        */
+    constexpr HebrewYearInfo hebrew_year_info(year_t year) {
+        if (std::is_constant_evaluated())
+            return detail::compute_hebrew_year_info(year);
+        return detail::cached_hebrew_year_info(year);
+    }
+
+    /**	Returns the year information of the Hebrew year containing a day.
+        The year is estimated exactly from the molad, then corrected by at most one year.
+        @param jdn [in] Julian Day Number of the day.
+        */
+    constexpr HebrewYearInfo hebrew_year_info_for_jdn(jdn_t jdn) {
+        // Months elapsed to the last molad falling on or before the day (a month is 765433 parts, a day 25920).
+        long long const months = detail::floor_div(25920 * (jdn - detail::HEBREW_TISHRI1_BASE + 1) - 12084 - 1, 765433);
+
+        // The year whose Tishri molad is the last one on or before the day: 1 Tishri is never
+        // before its molad, so the day is in that year or, if postponed past the day, the previous one.
+        year_t const year = detail::floor_div(19 * months + 252, 235);
+        HebrewYearInfo const info = hebrew_year_info(year);
+        return jdn < info.tishri1 ? hebrew_year_info(year - 1) : info;
+    }
+
+    // Converts a Hebrew date to its Julian Day Number.
+    constexpr jdn_t hebrew_to_jdn(year_t year, month_t month, day_t day) {
+        return hebrew_year_info(year).jdn(month, day);
+    }
+
+    // Converts a Julian Day Number to a Hebrew date in constant time.
+    constexpr void jdn_to_hebrew(jdn_t jdn, year_t& year, month_t& month, day_t& day) {
+        HebrewYearInfo const info = hebrew_year_info_for_jdn(jdn);
+        year = info.year;
+        info.month_day(static_cast<day_t>(jdn - info.tishri1), month, day);
+    }
+
+    // Converts a Hebrew date to the Julian Day of its midnight.
+    constexpr jd_t hebrew_to_jd(year_t year, month_t month, day_t day) {
+        // Month offsets from 1 Tishri come from the year's month-start table.
+        return static_cast<jd_t>(hebrew_to_jdn(year, month, day)) - 0.5;
+    }
+
+    // Converts a Hebrew date with time components to a Julian Day.
+    constexpr jd_t hebrew_to_jd(year_t year, month_t month, day_t day,
+        hour_t hour, minute_t minute, second_t second) {
+        double tod_ = tod(hour, minute, second);  // Calculate time of day fraction.
+        if (tod_ >= 0.5)
+            tod_ -= 1;  // Adjust if the time fraction exceeds half a day.
+
+        return hebrew_to_jd(year, month, day) + tod_;
+    }
+
+    // Converts a Julian Day to a Hebrew date (year, month, day).
+    constexpr void jd_to_hebrew(jd_t jd, year_t& year, month_t& month, day_t& day) {
+        // Adjust the day fraction (the day turns over at noon).
+        jdn_to_hebrew(utility::ifloor(jd + 1.0), year, month, day);
+    }
+
+    // Converts a Julian Day to a Hebrew date with time components.
+    constexpr void jd_to_hebrew(jd_t jd, year_t& year, month_t& month, day_t& day,
+        hour_t& hour, minute_t& minute, second_t& second) {
+        jd_to_hebrew(jd, year, month, day);  // Convert the date part.
+
+        // Extract the time of day from the fractional part of the JDN.
+        double const tod = jd + 0.5 - static_cast<double>(utility::ifloor(jd + 0.5));
+        int const totalSeconds = static_cast<int>(utility::ifloor(tod * SECONDS_PER_DAY + 0.5));
+
+        // Calculate hours, minutes, and seconds.
+        hour = totalSeconds / 3600;
+        minute = (totalSeconds % 3600) / 60;
+        second = totalSeconds % 60;
+    }
 
     // Class representing a Hebrew calendar date.
     class Hebrew {
@@ -97,12 +310,23 @@ namespace khronos {
 
     public:
         // Constructor for a Hebrew date with optional time components.
-        Hebrew(year_t year, month_t month, day_t day, hour_t hour = 0, minute_t minute = 0, second_t second = 0);
+        constexpr Hebrew(year_t year, month_t month, day_t day, hour_t hour = 0, minute_t minute = 0, second_t second = 0)
+            : year_(year), month_(month), day_(day), hour_(hour), minute_(minute), second_(second) {}
 
         Hebrew(); // Default constructor.
 
+        // Getter functions for each date and time component.
+        constexpr year_t year() const { return year_; }
+        constexpr month_t month() const { return month_; }
+        constexpr day_t day() const { return day_; }
+        constexpr hour_t hour() const { return hour_; }
+        constexpr minute_t minute() const { return minute_; }
+        constexpr second_t second() const { return second_; }
+
         std::string to_string() const; // Converts the date to a string.
-        double to_jd() const;          // Converts the date to a Julian Day Number.
+        // Converts the date to a Julian Day Number.
+        constexpr double to_jd() const { return hebrew_to_jd(year_, month_, day_, hour_, minute_, second_); }
+        constexpr operator Jd() const { return Jd(to_jd()); }  // Conversion to Julian Day.
         void from_jd(double jd);       // Initializes the date from a Julian Day Number.
     };
 
@@ -0,0 +1,95 @@
+#pragma once
+
+/**	@file khronos/hebrew_holidays.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library Jewish holidays.
+    hebrew_holidays(first_year, last_year) lists the holidays and fast days of a range of
+    Hebrew years in date order.  The years' 1 Tishri and lengths are built in one pass that
+    computes each molad delay once, and every holiday is then an offset into its year's
+    month-start table, with the fast-day postponements applied from the weekday.
+
+    Diaspora lists include the second days of Sukkot, Pesach and Shavuot and keep Simchat
+    Torah on 23 Tishri; in Israel Simchat Torah falls on Shemini Atzeret.  In leap years
+    Purim and the Fast of Esther are in Veadar.
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/hebrew_calendar.hpp>
+#include <vector>
+
+
+namespace khronos {
+
+    /** Holidays and fast days, in the order they fall in a Hebrew year. */
+    enum class HebrewHoliday {
+        rosh_hashanah, rosh_hashanah_2, fast_of_gedaliah, yom_kippur,
+        sukkot, sukkot_2, hoshana_rabbah, shemini_atzeret, simchat_torah,
+        hanukkah, tenth_of_tevet, fast_of_esther, purim, shushan_purim,
+        pesach, pesach_2, pesach_7, pesach_8, shavuot, shavuot_2,
+        seventeenth_of_tammuz, tisha_bav
+    };
+
+    /** Returns the name of a holiday as a c-string. */
+    constexpr char const* hebrew_holiday_name(HebrewHoliday holiday) {
+        switch (holiday) {
+        case HebrewHoliday::rosh_hashanah: return "Rosh Hashanah";
+        case HebrewHoliday::rosh_hashanah_2: return "Rosh Hashanah II";
+        case HebrewHoliday::fast_of_gedaliah: return "Fast of Gedaliah";
+        case HebrewHoliday::yom_kippur: return "Yom Kippur";
+        case HebrewHoliday::sukkot: return "Sukkot";
+        case HebrewHoliday::sukkot_2: return "Sukkot II";
+        case HebrewHoliday::hoshana_rabbah: return "Hoshana Rabbah";
+        case HebrewHoliday::shemini_atzeret: return "Shemini Atzeret";
+        case HebrewHoliday::simchat_torah: return "Simchat Torah";
+        case HebrewHoliday::hanukkah: return "Hanukkah";
+        case HebrewHoliday::tenth_of_tevet: return "Tenth of Tevet";
+        case HebrewHoliday::fast_of_esther: return "Fast of Esther";
+        case HebrewHoliday::purim: return "Purim";
+        case HebrewHoliday::shushan_purim: return "Shushan Purim";
+        case HebrewHoliday::pesach: return "Pesach";
+        case HebrewHoliday::pesach_2: return "Pesach II";
+        case HebrewHoliday::pesach_7: return "Pesach VII";
+        case HebrewHoliday::pesach_8: return "Pesach VIII";
+        case HebrewHoliday::shavuot: return "Shavuot";
+        case HebrewHoliday::shavuot_2: return "Shavuot II";
+        case HebrewHoliday::seventeenth_of_tammuz: return "Seventeenth of Tammuz";
+        case HebrewHoliday::tisha_bav: return "Tisha B'Av";
+        default: return "";
+        }
+    }
+
+    /** Where the holidays are observed. */
+    enum class HolidayRegion { diaspora, israel };
+
+    /** One observed holiday: its Hebrew year and the Julian Day of the midnight starting its civil day. */
+    struct HebrewHolidayDate {
+        HebrewHoliday   holiday;
+        year_t          year;
+        Jd              jd;
+    };
+
+    /**	Appends the holidays of the Hebrew years [first_year..last_year] to out, in date order.
+        Fast days are given on the day observed: the Fast of Gedaliah, the Seventeenth of Tammuz
+        and Tisha B'Av move from Shabbat to Sunday, and the Fast of Esther to the Thursday before.
+        @param first_year [in] first Hebrew year.
+        @param last_year [in] last Hebrew year (inclusive).
+        @param region [in] diaspora or Israel observance.
+        @param out [out] the holidays are appended.
+        */
+    void hebrew_holidays(year_t first_year, year_t last_year, HolidayRegion region, std::vector<HebrewHolidayDate>& out);
+
+    /**	Returns the holidays of the Hebrew years [first_year..last_year], in date order.
+        @param first_year [in] first Hebrew year.
+        @param last_year [in] last Hebrew year (inclusive).
+        @param region [in] diaspora or Israel observance.
+        */
+    inline std::vector<HebrewHolidayDate> hebrew_holidays(year_t first_year, year_t last_year, HolidayRegion region = HolidayRegion::diaspora) {
+        std::vector<HebrewHolidayDate> out;
+        hebrew_holidays(first_year, last_year, region, out);
+        return out;
+    }
+
+} // end-of-namespace khronos
@@ -11,6 +11,10 @@
 #include <khronos/gregorian_calendar.hpp>
 #include <khronos/timeofday.hpp>
 #include <khronos/julian_day.hpp>
+#include <khronos/clock.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <string>
 
 
@@ -23,19 +27,136 @@ namespace khronos {
         Shawwal, DhulQadah, DhulHijja
     };
 
-    // The epoch for the Islamic calendar (Julian Day Number for Islamic year 1).
+    /**	Leap-year patterns of the tabular calendar's 30-year cycle.
+        Year y is a leap year (Dhul Hijja has 30 days) when (11 y + SHIFT) mod 30 < 11.
+        */
+    struct IslamicLeap16 {  // leap years 2, 5, 7, 10, 13, 16, 18, 21, 24, 26, 29 of the cycle
+        static constexpr int SHIFT = 14;
+    };
+    struct IslamicLeap15 {  // leap years 2, 5, 7, 10, 13, 15, 18, 21, 24, 26, 29 of the cycle
+        static constexpr int SHIFT = 15;
+    };
+
+    /** Epochs of the tabular calendar: the JDN of 1 Muharram 1. */
+    struct IslamicCivilEpoch {          // Friday, 16 July 622 (Julian)
+        static constexpr jdn_t JDN = 1'948'440;
+    };
+    struct IslamicAstronomicalEpoch {   // Thursday, 15 July 622 (Julian)
+        static constexpr jdn_t JDN = 1'948'439;
+    };
+
+    // The epoch for the Islamic calendar (Julian Day of the midnight starting 1 Muharram 1, civil epoch).
     constexpr jd_t ISLAMIC_EPOCH = 1948439.5;
 
     // Function prototypes for Islamic calendar operations.
     std::string islamic_month_name(month_t month);
-    jd_t islamic_to_jd(year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second);
-    jd_t islamic_to_jd(year_t year, month_t month, day_t day);
-    void jd_to_islamic(jd_t jd, year_t& year, month_t& month, day_t& day);
-    void jd_to_islamic(jd_t jd, year_t& year, month_t& month, day_t& day, hour_t& hour, minute_t& minute, second_t& second);
 
-    // Class representing an Islamic calendar date.
-    class Islamic {
+    // Determines if the given Islamic year is a leap year (floor modulo, so years before 1 follow the same cycle as islamic_to_jdn).
+    template <class LeapPattern = IslamicLeap16>
+    constexpr bool is_islamic_leapyear(year_t year) {
+        return (((11 * year + LeapPattern::SHIFT) % 30) + 30) % 30 < 11;
+    }
+
+    // Returns the number of days in the given Islamic month.
+    constexpr unsigned islamic_days_in_month(month_t month_, bool isLeapYear) {
+        if (month_ == DhulQadah) {
+            return 30; // DhulQadah always has 30 days.
+        }
+        if (month_ == DhulHijja) {
+            return isLeapYear ? 30 : 29; // DhulHijja varies based on leap year.
+        }
+        return (month_ % 2 == 1) ? 30 : 29; // Other months alternate between 29 and 30 days.
+    }
+
+    /**	Converts an Islamic date to its Julian Day Number using integer arithmetic only.
+        @return the JDN of the day (JD of midnight + 0.5).
+        @param year [in] year, |year| < 10^15
+        @param month [in] month number [1..12]
+        @param day [in] day of the month [1..30]
+        */
+    template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+    constexpr jdn_t islamic_to_jdn(year_t year, month_t month, day_t day) {
+        jdn_t const leap = 11 * year + LeapPattern::SHIFT - 11;          // leap days before the year = floor(leap / 30)
+        return day + (59 * (month - 1) + 1) / 2 + (year - 1) * 354       // ceil(29.5 * (month - 1))
+            + (leap >= 0 ? leap : leap - 29) / 30 + Epoch::JDN - 1;
+    }
+
+    /**	Returns the length of an Islamic month as the kernel counts it (the distance to the next month's first day).
+        @param year [in] year
+        @param month [in] month number [1..12]
+        */
+    template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+    constexpr jdn_t islamic_month_length(year_t year, month_t month) {
+        jdn_t const next = month < 12 ? islamic_to_jdn<LeapPattern, Epoch>(year, month + 1, 1) : islamic_to_jdn<LeapPattern, Epoch>(year + 1, 1, 1);
+        return next - islamic_to_jdn<LeapPattern, Epoch>(year, month, 1);
+    }
+
+    /**	Converts a Julian Day Number to an Islamic date using integer arithmetic only.
+        @param jdn [in] Julian Day Number
+        @param year [out] year
+        @param month [out] month number [1..12]
+        @param day [out] day of the month [1..30]
+        */
+    template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+    constexpr void jdn_to_islamic(jdn_t jdn, year_t& year, month_t& month, day_t& day) {
+        // The last year starting on or before the day: 30-year cycles of 10631 days (scaled by 30).
+        jdn_t const cycles = 30 * (jdn - Epoch::JDN) + 10'660 - LeapPattern::SHIFT;
+        year = (cycles >= 0 ? cycles : cycles - 10'630) / 10'631;
+        jdn_t const doy = jdn - islamic_to_jdn<LeapPattern, Epoch>(year, 1, 1);   // [0..354]
+        month = static_cast<month_t>(std::min<jdn_t>(12, 2 * doy / 59 + 1));
+        day = static_cast<day_t>(jdn - islamic_to_jdn<LeapPattern, Epoch>(year, month, 1) + 1);
+    }
+
+    // Converts an Islamic date to the Julian Day of its midnight.
+    template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+    constexpr jd_t islamic_to_jd(year_t year, month_t month, day_t day) {
+        return static_cast<jd_t>(islamic_to_jdn<LeapPattern, Epoch>(year, month, day)) - 0.5;
+    }
+
+    // Converts an Islamic date with time components to a Julian Day.
+    template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+    constexpr jd_t islamic_to_jd(year_t year, month_t month, day_t day,
+        hour_t hour, minute_t minute, second_t second) {
+        double tod_ = tod(hour, minute, second);  // Calculate time fraction.
+        if (tod_ >= 0.5)
+            tod_ -= 1;  // Adjust if time fraction exceeds half a day.
+
+        return islamic_to_jd<LeapPattern, Epoch>(year, month, day) + tod_;
+    }
+
+    // Converts a Julian Day to an Islamic date.
+    template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+    constexpr void jd_to_islamic(jd_t jd, year_t& year, month_t& month, day_t& day) {
+        // Adjust the day fraction (the day turns over at noon).
+        jdn_to_islamic<LeapPattern, Epoch>(utility::ifloor(jd) + 1, year, month, day);
+    }
+
+    // Converts a Julian Day to an Islamic date with time components.
+    template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+    constexpr void jd_to_islamic(jd_t jd, year_t& year, month_t& month, day_t& day,
+        hour_t& hour, minute_t& minute, second_t& second) {
+        jd_to_islamic<LeapPattern, Epoch>(jd, year, month, day);  // Convert date part.
+
+        // Extract the time of day.
+        double const tod = (jd + 0.5) - static_cast<double>(utility::ifloor(jd + 0.5));
+        int const secondsInDay = static_cast<int>(utility::ifloor(tod * SECONDS_PER_DAY + 0.5));
+        hour = secondsInDay / 3600;
+        minute = (secondsInDay / 60) % 60;
+        second = secondsInDay % 60;
+    }
+
+
+
+    /**	Date in a tabular Islamic calendar.
+        The leap-year pattern and the epoch are compile-time policies, so every variant has its
+        own constexpr kernels; Islamic is the civil calendar with the 16-type cycle.
+        */
+    template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+    class IslamicTabular {
     public:
+        using leap_pattern = LeapPattern;
+        using epoch = Epoch;
+
         year_t year_;     
         month_t month_;   
         day_t day_;       
@@ -43,22 +164,34 @@ namespace khronos {
         minute_t minute_{ 0 }; 
         second_t second_{ 0.0 }; 
 
-        Islamic(); // Default constructor.
-        Islamic(now_t option); // Constructor with current time option.
+        IslamicTabular() : IslamicTabular(WTIMEOFDAY) {} // Default constructor: the current local time.
+
+        // Constructor with current time option.
+        IslamicTabular(now_t option) {
+            clock::LocalTime const now = clock::local_time();
+
+            // Convert current Gregorian date to Julian Day and then to Islamic.
+            if (option == WTIMEOFDAY) {
+                jd_t jd = gregorian_to_jd(now.year, now.month, now.day, now.hour, now.minute, now.second);
+                jd_to_islamic<LeapPattern, Epoch>(jd, year_, month_, day_, hour_, minute_, second_);
+            }
+            else
+                jd_to_islamic<LeapPattern, Epoch>(gregorian_to_jd(now.year, now.month, now.day), year_, month_, day_);
+        }
 
         // Constructor with year, month, day, and optional time.
-        Islamic(year_t y, month_t m, day_t d, hour_t h = 0, minute_t mi = 0, second_t s = 0)
+        constexpr IslamicTabular(year_t y, month_t m, day_t d, hour_t h = 0, minute_t mi = 0, second_t s = 0)
             : year_(y), month_(m), day_(d), hour_(h), minute_(mi), second_(s) {}
 
         // Equality operator to compare two Islamic dates.
-        constexpr bool operator==(const Islamic& other) const {
+        constexpr bool operator==(const IslamicTabular& other) const {
             return (year_ == other.year_ && month_ == other.month_ && day_ == other.day_ &&
                 hour_ == other.hour_ && minute_ == other.minute_ && second_ == other.second_);
         }
 
-        // Converts the Islamic date to a Julian Day Number (JDN).
-        jd_t to_jd() const {
-            return islamic_to_jd(year_, month_, day_, hour_, minute_, second_);
+        // Converts the Islamic date to a Julian Day.
+        constexpr jd_t to_jd() const {
+            return islamic_to_jd<LeapPattern, Epoch>(year_, month_, day_, hour_, minute_, second_);
         }
 
         // Getter functions for each date and time component.
@@ -70,31 +203,57 @@ namespace khronos {
         constexpr second_t second() const { return second_; }
 
         // Conversion operator to Julian Day.
-        operator Jd() const;
+        constexpr operator Jd() const { return Jd(to_jd()); }
     };
 
-    // Determines if the given Islamic year is a leap year.
-    constexpr bool is_islamic_leapyear(year_t year) {
-        return ((11 * year + 14) % 30) < 11;
-    }
+    // The civil tabular Islamic calendar.
+    using Islamic = IslamicTabular<>;
 
-    // Returns the number of days in the given Islamic month.
-    constexpr unsigned islamic_days_in_month(month_t month_, bool isLeapYear) {
-        if (month_ == DhulQadah) {
-            return 30; // DhulQadah always has 30 days.
-        }
-        if (month_ == DhulHijja) {
-            return isLeapYear ? 30 : 29; // DhulHijja varies based on leap year.
-        }
-        return (month_ % 2 == 1) ? 30 : 29; // Other months alternate between 29 and 30 days.
+    /**	Adds a number of months to an Islamic date in constant time.
+        The day is clamped to the length of the resulting month.
+        @param n [in] signed month offset
+        @return the shifted date, with the time of day unchanged.
+        */
+    template <class LeapPattern, class Epoch>
+    constexpr IslamicTabular<LeapPattern, Epoch> add_months(IslamicTabular<LeapPattern, Epoch> const& date, std::int64_t n) {
+        // Work on the absolute month index (months since 1 Muharram 1).
+        std::int64_t const index = (date.year_ - 1) * 12 + (date.month_ - 1) + n;
+        year_t const year = (index >= 0 ? index : index - 11) / 12 + 1;
+        month_t const month = static_cast<month_t>(index - (year - 1) * 12 + 1);
+
+        // Adjust the day to fit within the new month.
+        jdn_t const first = islamic_to_jdn<LeapPattern, Epoch>(year, month, 1);
+        jdn_t const next = month == 12 ? islamic_to_jdn<LeapPattern, Epoch>(year + 1, 1, 1) : islamic_to_jdn<LeapPattern, Epoch>(year, month + 1, 1);
+        day_t const day = std::min(date.day_, static_cast<day_t>(next - first));
+
+        return IslamicTabular<LeapPattern, Epoch>(year, month, day, date.hour_, date.minute_, date.second_);
     }
 
-    // Function prototypes for adding months or days to an Islamic date.
-    Islamic add_months(Islamic const& date, int n);
-    Islamic add_days(Islamic const& date, int n);
+    /**	Adds a number of days to an Islamic date in constant time.
+        @param n [in] signed day offset
+        @return the shifted date, with the time of day unchanged.
+        */
+    template <class LeapPattern, class Epoch>
+    constexpr IslamicTabular<LeapPattern, Epoch> add_days(IslamicTabular<LeapPattern, Epoch> const& date, std::int64_t n) {
+        year_t year{};
+        month_t month{};
+        day_t day{};
+        jdn_to_islamic<LeapPattern, Epoch>(islamic_to_jdn<LeapPattern, Epoch>(date.year_, date.month_, date.day_) + n, year, month, day);
+        return IslamicTabular<LeapPattern, Epoch>(year, month, day, date.hour_, date.minute_, date.second_);
+    }
 
     // Comparison operators between Islamic and Gregorian dates.
-    bool operator==(const Islamic& islamic, const Gregorian& gregorian);
-    bool operator==(const Gregorian& gregorian, const Islamic& islamic);
+    template <class LeapPattern, class Epoch>
+    bool operator==(IslamicTabular<LeapPattern, Epoch> const& islamic, Gregorian const& gregorian) {
+        jd_t const gregorian_jd = gregorian_to_jd(
+            gregorian.year(), gregorian.month(), gregorian.day(),
+            gregorian.hour(), gregorian.minute(), gregorian.second());
+        return std::abs(islamic.to_jd() - gregorian_jd) < 1e-9;  // Precision check.
+    }
+
+    template <class LeapPattern, class Epoch>
+    bool operator==(Gregorian const& gregorian, IslamicTabular<LeapPattern, Epoch> const& islamic) {
+        return islamic == gregorian;
+    }
 
 } // end of namespace khronos
@@ -0,0 +1,75 @@
+#pragma once
+
+/**	@file khronos/iso8601.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library ISO 8601 parser declarations.
+    Accepted form:  [+|-]YYYY-MM-DD[(T| )hh:mm[:ss[(.|,)f...]][Z|(+|-)hh[:mm]]]
+    Years are astronomical (0000 is 1 BCE, -0001 is 2 BCE, as with _BCE); a sign allows
+    more than four year digits.  A zone designator converts the result to UTC.
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <cassert>
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+
+namespace khronos {
+
+    /** Reasons an ISO 8601 string (or a recurrence rule) is rejected. */
+    enum class ParseError { none = 0, syntax, invalid_date, invalid_time, year_out_of_range, invalid_rule };
+
+    /** Returns the name of the parse error as a c-string. */
+    constexpr char const* parse_error_name(ParseError error) {
+        switch (error) {
+        case ParseError::none: return "none";
+        case ParseError::syntax: return "syntax";
+        case ParseError::invalid_date: return "invalid date";
+        case ParseError::invalid_time: return "invalid time";
+        case ParseError::year_out_of_range: return "year out of range";
+        case ParseError::invalid_rule: return "invalid rule";
+        default: return "";
+        }
+    }
+
+    /** A parsed Julian Day or the reason parsing failed (shaped after std::expected<Jd, ParseError>). */
+    class ParseResult {
+        Jd value_{ 0.0 };
+        ParseError error_{ ParseError::none };
+    public:
+        constexpr ParseResult(Jd value) : value_(value) {}
+        constexpr ParseResult(ParseError error) : error_(error) {}
+
+        constexpr bool has_value() const { return error_ == ParseError::none; }
+        constexpr explicit operator bool() const { return has_value(); }
+        constexpr Jd value() const { assert(has_value()); return value_; }
+        constexpr Jd operator*() const { return value(); }
+        constexpr ParseError error() const { return error_; }
+    };
+
+    /**	Parses an ISO 8601 date or date-time.
+        @return the Julian Day, equal to gregorian_to_jd() of the parsed fields (converted to UTC when a zone is given).
+        @param text [in] the date; no surrounding white space
+        */
+    ParseResult parse_iso8601(std::string_view text);
+
+    /**	Parses a buffer of ISO 8601 dates separated by newlines or commas, appending one Julian Day per record.
+        Empty records are skipped and a trailing '\r' is ignored.  A record that does not parse appends NaN.
+        @return the number of records that did not parse.
+        */
+    std::size_t parse_iso8601(std::string_view text, std::vector<jd_t>& out);
+
+    /**	Parses a buffer of ISO 8601 dates separated by newlines or commas into date columns.
+        A zone offset is folded into the minutes column, so batch::gregorian_to_jd of the columns is UTC.
+        A record that does not parse appends a row of zeros (month 0).
+        @return the number of records that did not parse.
+        */
+    std::size_t parse_iso8601(std::string_view text,
+        std::vector<year_t>& years, std::vector<month_t>& months, std::vector<day_t>& days,
+        std::vector<hour_t>& hours, std::vector<minute_t>& minutes, std::vector<second_t>& seconds);
+
+} // end-of-namespace khronos
@@ -0,0 +1,214 @@
+#pragma once
+
+/**	@file khronos/jd_exact.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library exact Julian Day class declaration.
+    A JdExact holds the Julian Day Number of a civil day and the nanoseconds elapsed since
+    its midnight, both as integers, so comparisons, hashing and arithmetic are exact.
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/gregorian_calendar.hpp>
+#include <khronos/julian_calendar.hpp>
+#include <khronos/islamic_calendar.hpp>
+#include <khronos/hebrew_calendar.hpp>
+
+#include <compare>
+#include <cstdint>
+#include <functional>
+
+
+namespace khronos {
+
+    // Class representing a Julian Day as an integer day number and nanoseconds of the day.
+    class JdExact {
+    public:
+        static constexpr std::int64_t NS_PER_SECOND = 1'000'000'000;
+        static constexpr std::int64_t NS_PER_DAY = 86'400 * NS_PER_SECOND;
+
+    private:
+        jdn_t jdn_;             // Julian Day Number of the civil day (JD of its midnight + 0.5).
+        std::int64_t ns_;       // Nanoseconds since midnight [0..NS_PER_DAY).
+
+    public:
+        /**	Constructs from a day number and a time of day.
+            @param jdn [in] Julian Day Number of the civil day
+            @param nanoseconds [in] nanoseconds since midnight; values outside a day carry into jdn.
+            */
+        constexpr JdExact(jdn_t jdn, std::int64_t nanoseconds = 0)
+            : jdn_(jdn + nanoseconds / NS_PER_DAY), ns_(nanoseconds % NS_PER_DAY) {
+            if (ns_ < 0) {
+                ns_ += NS_PER_DAY;
+                --jdn_;
+            }
+        }
+
+        // Constructs from a Julian Day, to the nearest nanosecond.
+        explicit JdExact(Jd jd);
+
+        // Returns the Julian Day Number of the civil day.
+        constexpr jdn_t jdn() const { return jdn_; }
+
+        // Returns the nanoseconds since midnight.
+        constexpr std::int64_t nanoseconds() const { return ns_; }
+
+        // Converts to the nearest Julian Day.
+        jd_t jd() const;
+        explicit operator Jd() const { return Jd(jd()); }
+
+        constexpr auto operator <=> (JdExact const&) const = default;
+        constexpr bool operator == (JdExact const&) const = default;
+    };
+
+
+
+    // Adds whole days to an exact Julian Day.
+    constexpr JdExact add_days(JdExact const& jd, std::int64_t n) {
+        return JdExact(jd.jdn() + n, jd.nanoseconds());
+    }
+
+    // Adds nanoseconds to an exact Julian Day.
+    constexpr JdExact add_nanoseconds(JdExact const& jd, std::int64_t n) {
+        return JdExact(jd.jdn() + n / JdExact::NS_PER_DAY, jd.nanoseconds() + n % JdExact::NS_PER_DAY);
+    }
+
+    /**	Returns the nanoseconds from one exact Julian Day to another.
+        @pre the difference is less than 2^63 ns (about 292 years).
+        */
+    constexpr std::int64_t nanoseconds_between(JdExact const& from, JdExact const& to) {
+        return (to.jdn() - from.jdn()) * JdExact::NS_PER_DAY + (to.nanoseconds() - from.nanoseconds());
+    }
+
+    // Subtract two exact Julian Days to get the difference in days.
+    constexpr jd_t operator - (JdExact const& lhs, JdExact const& rhs) {
+        return static_cast<jd_t>(lhs.jdn() - rhs.jdn())
+            + static_cast<jd_t>(lhs.nanoseconds() - rhs.nanoseconds()) / JdExact::NS_PER_DAY;
+    }
+
+    // Add (possibly fractional) days to an exact Julian Day.
+    JdExact operator + (JdExact const& jd, days const& d);
+    JdExact operator - (JdExact const& jd, days const& d);
+    inline JdExact operator + (days const& d, JdExact const& jd) { return jd + d; }
+    inline JdExact operator + (JdExact const& jd, weeks const& w) { return jd + days(w.value); }
+    inline JdExact operator - (JdExact const& jd, weeks const& w) { return jd - days(w.value); }
+
+    // Overload of << operator to print an exact Julian Day.
+    std::ostream& operator << (std::ostream& os, JdExact const& jd);
+
+
+
+    // --------------------------------------------------------------------------------------
+    // CALENDAR CONVERSIONS
+    // --------------------------------------------------------------------------------------
+
+    namespace detail {
+        // Nanoseconds since midnight of a time of day, to the nearest nanosecond.
+        constexpr std::int64_t time_to_ns(hour_t hour, minute_t minute, second_t second) {
+            double const ns = second * JdExact::NS_PER_SECOND;
+            return (hour * std::int64_t(3'600) + minute * std::int64_t(60)) * JdExact::NS_PER_SECOND
+                + static_cast<std::int64_t>(ns >= 0 ? ns + 0.5 : ns - 0.5);
+        }
+
+        // Splits nanoseconds since midnight into a time of day.
+        constexpr void ns_to_time(std::int64_t ns, hour_t& hour, minute_t& minute, second_t& second) {
+            std::int64_t const s = ns / JdExact::NS_PER_SECOND;
+            hour = static_cast<hour_t>(s / 3'600);
+            minute = static_cast<minute_t>(s / 60 % 60);
+            second = static_cast<second_t>(ns % (60 * JdExact::NS_PER_SECOND)) / JdExact::NS_PER_SECOND;
+        }
+
+        // Hebrew and Islamic days turn over at noon: hours 12..23 belong to the previous civil day.
+        constexpr bool afternoon(std::int64_t ns) { return ns >= JdExact::NS_PER_DAY / 2; }
+    }
+
+    // Converts a Gregorian date and time to an exact Julian Day.
+    constexpr JdExact to_jd_exact(Gregorian const& g) {
+        return JdExact(gregorian_to_jdn(g.year(), g.month(), g.day()), detail::time_to_ns(g.hour(), g.minute(), g.second()));
+    }
+
+    // Converts an exact Julian Day to a Gregorian date and time.
+    constexpr Gregorian to_gregorian(JdExact const& jd) {
+        year_t year;
+        month_t month;
+        day_t day;
+        hour_t hour;
+        minute_t minute;
+        second_t second;
+        jdn_to_gregorian(jd.jdn(), year, month, day);
+        detail::ns_to_time(jd.nanoseconds(), hour, minute, second);
+        return Gregorian(year, month, day, hour, minute, second);
+    }
+
+    // Converts a Julian calendar date and time to an exact Julian Day.
+    constexpr JdExact to_jd_exact(Julian const& j) {
+        return JdExact(julian_to_jdn(j.year(), j.month(), j.day()), detail::time_to_ns(j.hour(), j.minute(), j.second()));
+    }
+
+    // Converts an exact Julian Day to a Julian calendar date and time.
+    constexpr Julian to_julian(JdExact const& jd) {
+        year_t year;
+        month_t month;
+        day_t day;
+        hour_t hour;
+        minute_t minute;
+        second_t second;
+        jdn_to_julian(jd.jdn(), year, month, day);
+        detail::ns_to_time(jd.nanoseconds(), hour, minute, second);
+        return Julian(year, month, day, hour, minute, second);
+    }
+
+    // Converts an Islamic date and time (any tabular variant) to an exact Julian Day.
+    template <class LeapPattern, class Epoch>
+    constexpr JdExact to_jd_exact(IslamicTabular<LeapPattern, Epoch> const& i) {
+        std::int64_t const ns = detail::time_to_ns(i.hour(), i.minute(), i.second());
+        return JdExact(islamic_to_jdn<LeapPattern, Epoch>(i.year(), i.month(), i.day()) - detail::afternoon(ns), ns);
+    }
+
+    // Converts an exact Julian Day to an Islamic date and time: to_islamic(jd) or to_islamic<LeapPattern, Epoch>(jd).
+    template <class LeapPattern = IslamicLeap16, class Epoch = IslamicCivilEpoch>
+    constexpr IslamicTabular<LeapPattern, Epoch> to_islamic(JdExact const& jd) {
+        year_t year;
+        month_t month;
+        day_t day;
+        hour_t hour;
+        minute_t minute;
+        second_t second;
+        jdn_to_islamic<LeapPattern, Epoch>(jd.jdn() + detail::afternoon(jd.nanoseconds()), year, month, day);
+        detail::ns_to_time(jd.nanoseconds(), hour, minute, second);
+        return IslamicTabular<LeapPattern, Epoch>(year, month, day, hour, minute, second);
+    }
+
+    // Converts a Hebrew date and time to an exact Julian Day.
+    inline JdExact to_jd_exact(Hebrew const& h) {
+        std::int64_t const ns = detail::time_to_ns(h.hour(), h.minute(), h.second());
+        return JdExact(hebrew_to_jdn(h.year(), h.month(), h.day()) - detail::afternoon(ns), ns);
+    }
+
+    // Converts an exact Julian Day to a Hebrew date and time.
+    inline Hebrew to_hebrew(JdExact const& jd) {
+        year_t year;
+        month_t month;
+        day_t day;
+        hour_t hour;
+        minute_t minute;
+        second_t second;
+        jdn_to_hebrew(jd.jdn() + detail::afternoon(jd.nanoseconds()), year, month, day);
+        detail::ns_to_time(jd.nanoseconds(), hour, minute, second);
+        return Hebrew(year, month, day, hour, minute, second);
+    }
+
+} // end-of-namespace khronos
+
+
+
+// Hashes an exact Julian Day.
+template <>
+struct std::hash<khronos::JdExact> {
+    std::size_t operator()(khronos::JdExact const& jd) const noexcept {
+        std::uint64_t const h = static_cast<std::uint64_t>(jd.jdn()) * 0x9E37'79B9'7F4A'7C15ULL;
+        return std::hash<std::uint64_t>{}(h ^ static_cast<std::uint64_t>(jd.nanoseconds()));
+    }
+};
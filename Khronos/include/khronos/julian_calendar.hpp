@@ -55,13 +55,72 @@ namespace khronos {
         return -(year - 1);
     }
 
-    // Function prototypes for conversions between Julian and Julian Day.
-    jd_t julian_to_jd(year_t year, month_t month, day_t day);
-    jd_t julian_to_jd(year_t year, month_t month, day_t day,
-        hour_t hour, minute_t minute, second_t second);
-    void jd_to_julian(jd_t jd, year_t& year, month_t& month, day_t& day);
-    void jd_to_julian(jd_t jd, year_t& year, month_t& month, day_t& day,
-        hour_t& hour, minute_t& minute, second_t& second);
+    /**	Converts a proleptic Julian date to its Julian Day Number using integer arithmetic only.
+        @return the JDN of the day (JD of midnight + 0.5).
+        @param year [in] astronomical year, |year| < 10^15
+        @param month [in] month number [1..12]
+        @param day [in] day of the month [1..31]
+        */
+    constexpr jdn_t julian_to_jdn(year_t year, month_t month, day_t day) {
+        // Shift to a March-based year so that the leap day falls at the end of the year.
+        year_t const y = month <= 2 ? year - 1 : year;
+        jdn_t const era = (y >= 0 ? y : y - 3) / 4;                       // 4-year cycle (floored).
+        jdn_t const yoe = y - era * 4;                                    // [0..3]
+        jdn_t const mp = month > 2 ? month - 3 : month + 9;               // [0..11], March = 0
+        jdn_t const doy = (153 * mp + 2) / 5 + day - 1;                   // [0..365]
+        return era * 1'461 + yoe * 365 + doy + 1'721'118;
+    }
+
+    /**	Converts a Julian Day Number to a proleptic Julian date using integer arithmetic only.
+        @param jdn [in] Julian Day Number
+        @param year [out] astronomical year
+        @param month [out] month number [1..12]
+        @param day [out] day of the month [1..31]
+        */
+    constexpr void jdn_to_julian(jdn_t jdn, year_t& year, month_t& month, day_t& day) {
+        jdn_t const z = jdn - 1'721'118;                                  // days since 0000-03-01
+        jdn_t const era = (z >= 0 ? z : z - 1'460) / 1'461;               // 4-year cycle (floored).
+        jdn_t const doe = z - era * 1'461;                                // [0..1460]
+        jdn_t const yoe = (doe - doe / 1'460) / 365;                      // [0..3]
+        jdn_t const doy = doe - 365 * yoe;                                // [0..365]
+        jdn_t const mp = (5 * doy + 2) / 153;                             // [0..11], March = 0
+        day = static_cast<day_t>(doy - (153 * mp + 2) / 5 + 1);
+        month = static_cast<month_t>(mp < 10 ? mp + 3 : mp - 9);
+        year = static_cast<year_t>(yoe + era * 4 + (month <= 2));
+    }
+
+    // Converts a Julian date (year, month, day) to the Julian Day of its midnight.
+    constexpr jd_t julian_to_jd(year_t year, month_t month, day_t day) {
+        return static_cast<jd_t>(julian_to_jdn(year, month, day)) - 0.5;
+    }
+
+    // Converts a Julian date with time components to a Julian Day.
+    constexpr jd_t julian_to_jd(year_t year, month_t month, day_t day,
+        hour_t hour, minute_t minute, second_t second) {
+        // Add the fractional day from time of day to the JDN.
+        return julian_to_jd(year, month, day) + tod(hour, minute, second);
+    }
+
+    // Converts a Julian Day to a Julian date (year, month, day).
+    constexpr void jd_to_julian(jd_t jd, year_t& year, month_t& month, day_t& day) {
+        jdn_to_julian(utility::ifloor(jd + 0.5), year, month, day);
+    }
+
+    // Converts a Julian Day to a Julian date with time components.
+    constexpr void jd_to_julian(jd_t jd, year_t& year, month_t& month, day_t& day,
+        hour_t& hour, minute_t& minute, second_t& second) {
+        // Convert the date part first.
+        jd_to_julian(jd, year, month, day);
+
+        // Extract the fractional part of the day.
+        double const tod = (jd + 0.5) - static_cast<double>(utility::ifloor(jd + 0.5));
+        int const secondsInDay = static_cast<int>(utility::ifloor(tod * SECONDS_PER_DAY + 0.5));
+
+        // Extract hours, minutes, and seconds from the total seconds.
+        hour = secondsInDay / 3600;
+        minute = (secondsInDay / 60) % 60;
+        second = secondsInDay % 60;
+    }
 
     // Class representing a Julian calendar date.
     class Julian {
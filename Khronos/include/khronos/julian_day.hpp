@@ -35,6 +35,7 @@ the program(s) have been supplied.
 #include <khronos/timeofday.hpp>
 #include <khronos/utility.hpp>
 
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <ctime>
@@ -44,6 +45,7 @@ the program(s) have been supplied.
 namespace khronos {
 
     using jd_t = double;  // Alias for Julian Day type.
+    using jdn_t = std::int64_t;  // Alias for integer Julian Day Number type (the day beginning at noon).
     constexpr jd_t GREGORIAN_EPOCH = 1721425.5;  // Epoch for the Gregorian calendar.
 
     // Structure representing a number of days.
@@ -0,0 +1,102 @@
+#pragma once
+
+/**	@file khronos/literals.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library date literals.
+    "2024-03-01"_greg, "2024-02-16"_jul, "1445-08-20"_isl and "5784-07-01"_heb are evaluated at
+    compile time and yield the Jd of the date's midnight.  Years may carry a sign ("-0044-03-15"_jul)
+    and months use the calendar's own numbering (Hebrew 7 is Tishri).  A malformed or impossible
+    date does not compile.
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/gregorian_calendar.hpp>
+#include <khronos/julian_calendar.hpp>
+#include <khronos/islamic_calendar.hpp>
+#include <khronos/hebrew_calendar.hpp>
+#include <cstddef>
+
+
+namespace khronos {
+
+    namespace detail {
+        // Deliberately not constexpr: reaching it during constant evaluation makes the literal ill-formed.
+        void invalid_date_literal();
+
+        struct DateLiteral {
+            year_t  year;
+            month_t month;
+            day_t   day;
+        };
+
+        // Parses a run of digits at text[pos], advancing pos; at least one digit is required.
+        consteval long long parse_literal_number(char const* text, std::size_t size, std::size_t& pos) {
+            if (pos >= size || text[pos] < '0' || text[pos] > '9')
+                invalid_date_literal();
+            long long value = 0;
+            for (; pos < size && text[pos] >= '0' && text[pos] <= '9'; ++pos)
+                value = value * 10 + (text[pos] - '0');
+            return value;
+        }
+
+        // Parses "[+|-]Y...-MM-DD" and checks the month is in [1..maxMonth].
+        consteval DateLiteral parse_date_literal(char const* text, std::size_t size, month_t maxMonth) {
+            std::size_t pos = 0;
+            bool const negative = size > 0 && text[0] == '-';
+            if (size > 0 && (text[0] == '-' || text[0] == '+'))
+                ++pos;
+            long long const year = parse_literal_number(text, size, pos);
+            if (pos >= size || text[pos++] != '-')
+                invalid_date_literal();
+            long long const month = parse_literal_number(text, size, pos);
+            if (pos >= size || text[pos++] != '-')
+                invalid_date_literal();
+            long long const day = parse_literal_number(text, size, pos);
+            if (pos != size || month < 1 || month > maxMonth || day < 1)
+                invalid_date_literal();
+            return { static_cast<year_t>(negative ? -year : year), static_cast<month_t>(month), static_cast<day_t>(day) };
+        }
+    }
+
+
+
+    inline namespace literals {
+
+        // Gregorian date literal: "2024-03-01"_greg.
+        consteval Jd operator""_greg(char const* text, std::size_t size) {
+            detail::DateLiteral const d = detail::parse_date_literal(text, size, 12);
+            if (d.day > gregorian_days_in_month(d.month, is_gregorian_leapyear(d.year)))
+                detail::invalid_date_literal();
+            return Jd(gregorian_to_jd(d.year, d.month, d.day));
+        }
+
+        // Julian date literal: "2024-02-16"_jul.
+        consteval Jd operator""_jul(char const* text, std::size_t size) {
+            detail::DateLiteral const d = detail::parse_date_literal(text, size, 12);
+            if (d.day > julian_days_in_month(d.month, is_julian_leapyear(d.year)))
+                detail::invalid_date_literal();
+            return Jd(julian_to_jd(d.year, d.month, d.day));
+        }
+
+        // Islamic date literal: "1445-08-20"_isl.
+        consteval Jd operator""_isl(char const* text, std::size_t size) {
+            detail::DateLiteral const d = detail::parse_date_literal(text, size, 12);
+            if (d.day > islamic_month_length(d.year, d.month))
+                detail::invalid_date_literal();
+            return Jd(islamic_to_jd(d.year, d.month, d.day));
+        }
+
+        // Hebrew date literal: "5784-07-01"_heb (month 13, Veadar, only in leap years).
+        consteval Jd operator""_heb(char const* text, std::size_t size) {
+            detail::DateLiteral const d = detail::parse_date_literal(text, size, 13);
+            HebrewYearInfo const info = hebrew_year_info(d.year);
+            if (d.month > info.months_in_year() || d.day > info.days_in_month(d.month))
+                detail::invalid_date_literal();
+            return Jd(hebrew_to_jd(d.year, d.month, d.day));
+        }
+    }
+
+} // end-of-namespace khronos
@@ -0,0 +1,174 @@
+#pragma once
+
+/**	@file khronos/packed_date.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library packed date declarations.
+    PackedDate<Calendar> stores a date in 32 bits and PackedDateTime<Calendar> a date and
+    time of day in 64 bits.  Fields are laid out most significant first, so comparing the
+    packed integers orders the values chronologically.  In calendars whose day begins at noon
+    (calendar_traits<Calendar>::DAY_BEGINS_AT_NOON) the hour is stored as (hour + 12) % 24, so
+    the afternoon that opens the day sorts before its morning.
+
+    PackedDate bits:        [31..9] year + 2^22     [8..5] month slot   [4..0] day
+    PackedDateTime bits:    [63..32] PackedDate     [30..26] hour       [25..20] minute     [19..0] 1/10000 seconds
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/hebrew_calendar.hpp>
+#include <khronos/convert.hpp>
+
+#include <cassert>
+#include <compare>
+#include <cstdint>
+
+
+namespace khronos {
+
+    /**	Maps a calendar's month numbers to 4-bit slots in chronological order.
+        Specialize for calendars whose year does not begin with month 1.
+        */
+    template <class Calendar>
+    struct packed_month_order {
+        static constexpr unsigned slot(month_t month) { return static_cast<unsigned>(month); }
+        static constexpr month_t month(unsigned slot) { return static_cast<month_t>(slot); }
+    };
+
+    // The Hebrew year runs Tishri (7) .. Adar (12), Veadar (13), Nisan (1) .. Elul (6).
+    template <>
+    struct packed_month_order<Hebrew> {
+        static constexpr unsigned slot(month_t month) { return static_cast<unsigned>(month >= 7 ? month - 6 : month + 7); }
+        static constexpr month_t month(unsigned slot) { return static_cast<month_t>(slot <= 7 ? slot + 6 : slot - 7); }
+    };
+
+    // True if the calendar's day begins at noon; calendars without traits turn over at midnight.
+    template <class Calendar>
+    constexpr bool packed_day_begins_at_noon() {
+        if constexpr (requires { { calendar_traits<Calendar>::DAY_BEGINS_AT_NOON } -> std::convertible_to<bool>; })
+            return calendar_traits<Calendar>::DAY_BEGINS_AT_NOON;
+        else
+            return false;
+    }
+
+    // Years representable in a packed date.
+    constexpr year_t PACKED_DATE_MIN_YEAR = -(year_t(1) << 22);
+    constexpr year_t PACKED_DATE_MAX_YEAR = (year_t(1) << 22) - 1;
+
+
+
+    // Class representing a calendar date packed into 32 bits.
+    template <class Calendar>
+    class PackedDate {
+        std::uint32_t bits_{ 0 };
+
+    public:
+        constexpr PackedDate() = default;
+
+        // Packs a date.
+        constexpr PackedDate(year_t year, month_t month, day_t day) {
+            assert(year >= PACKED_DATE_MIN_YEAR && year <= PACKED_DATE_MAX_YEAR);
+            assert(month >= 1 && month <= 13);
+            assert(day >= 1 && day <= 31);
+            bits_ = static_cast<std::uint32_t>(year - PACKED_DATE_MIN_YEAR) << 9
+                | packed_month_order<Calendar>::slot(month) << 5
+                | static_cast<std::uint32_t>(day);
+        }
+
+        // Packs the date of a calendar object (the time of day is dropped).
+        constexpr explicit PackedDate(Calendar const& date) : PackedDate(date.year(), date.month(), date.day()) {}
+
+        // Reinterprets raw packed bits.
+        static constexpr PackedDate from_bits(std::uint32_t bits) {
+            PackedDate p;
+            p.bits_ = bits;
+            return p;
+        }
+
+        // Returns the packed bits.
+        constexpr std::uint32_t bits() const { return bits_; }
+
+        // Unpacked fields.
+        constexpr year_t year() const { return static_cast<year_t>(bits_ >> 9) + PACKED_DATE_MIN_YEAR; }
+        constexpr month_t month() const { return packed_month_order<Calendar>::month(bits_ >> 5 & 0xF); }
+        constexpr day_t day() const { return static_cast<day_t>(bits_ & 0x1F); }
+
+        // Unpacks into a calendar object.
+        constexpr Calendar unpack() const { return Calendar(year(), month(), day()); }
+        constexpr explicit operator Calendar() const { return unpack(); }
+
+        // Converts to a Julian Day (midnight) through the calendar class.
+        explicit operator Jd() const { return Jd(unpack()); }
+
+        constexpr auto operator <=> (PackedDate const&) const = default;
+        constexpr bool operator == (PackedDate const&) const = default;
+    };
+
+
+
+    // Class representing a calendar date and time of day packed into 64 bits (time to 1/10000 second).
+    template <class Calendar>
+    class PackedDateTime {
+        std::uint64_t bits_{ 0 };
+
+        // The hour field counts from the start of the calendar day; the mapping is its own inverse.
+        static constexpr unsigned HOUR_SHIFT = packed_day_begins_at_noon<Calendar>() ? 12 : 0;
+        static constexpr std::uint64_t hour_field(unsigned hour) { return (hour + HOUR_SHIFT) % 24; }
+
+    public:
+        static constexpr int TICKS_PER_SECOND = 10'000;
+
+        constexpr PackedDateTime() = default;
+
+        // Packs a date and time of day.
+        constexpr PackedDateTime(year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second) {
+            assert(hour >= 0 && hour < 24);
+            assert(minute >= 0 && minute < 60);
+            assert(second >= 0 && second < 60);
+            std::uint64_t ticks = static_cast<std::uint64_t>(second * TICKS_PER_SECOND + 0.5);
+            if (ticks >= 60 * TICKS_PER_SECOND)
+                ticks = 60 * TICKS_PER_SECOND - 1;
+            bits_ = std::uint64_t(PackedDate<Calendar>(year, month, day).bits()) << 32
+                | hour_field(static_cast<unsigned>(hour)) << 26
+                | std::uint64_t(minute) << 20
+                | ticks;
+        }
+
+        // Packs a calendar object.
+        constexpr explicit PackedDateTime(Calendar const& date)
+            : PackedDateTime(date.year(), date.month(), date.day(), date.hour(), date.minute(), date.second()) {}
+
+        // Packs a date at midnight.
+        constexpr explicit PackedDateTime(PackedDate<Calendar> date) : bits_(std::uint64_t(date.bits()) << 32 | hour_field(0) << 26) {}
+
+        // Reinterprets raw packed bits.
+        static constexpr PackedDateTime from_bits(std::uint64_t bits) {
+            PackedDateTime p;
+            p.bits_ = bits;
+            return p;
+        }
+
+        // Returns the packed bits.
+        constexpr std::uint64_t bits() const { return bits_; }
+
+        // Unpacked fields.
+        constexpr PackedDate<Calendar> date() const { return PackedDate<Calendar>::from_bits(static_cast<std::uint32_t>(bits_ >> 32)); }
+        constexpr year_t year() const { return date().year(); }
+        constexpr month_t month() const { return date().month(); }
+        constexpr day_t day() const { return date().day(); }
+        constexpr hour_t hour() const { return static_cast<hour_t>(hour_field(static_cast<unsigned>(bits_ >> 26 & 0x1F))); }
+        constexpr minute_t minute() const { return static_cast<minute_t>(bits_ >> 20 & 0x3F); }
+        constexpr second_t second() const { return static_cast<second_t>(bits_ & 0xF'FFFF) / TICKS_PER_SECOND; }
+
+        // Unpacks into a calendar object.
+        constexpr Calendar unpack() const { return Calendar(year(), month(), day(), hour(), minute(), second()); }
+        constexpr explicit operator Calendar() const { return unpack(); }
+
+        // Converts to a Julian Day through the calendar class.
+        explicit operator Jd() const { return Jd(unpack()); }
+
+        constexpr auto operator <=> (PackedDateTime const&) const = default;
+        constexpr bool operator == (PackedDateTime const&) const = default;
+    };
+
+} // end-of-namespace khronos
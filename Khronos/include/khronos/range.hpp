@@ -0,0 +1,172 @@
+#pragma once
+
+/**	@file khronos/range.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library lazy date ranges.
+    range(first, last, step) is a random-access view of the dates first, first + step, ...
+    up to but excluding last, in the calendar of first.  The iterator carries the decoded
+    year, month and day forward (day += step, rolling the month over with the calendar's
+    month lengths), so walking a range never converts through a Jd.  Long jumps decode
+    once from the integer day number.
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/convert.hpp>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <ranges>
+
+
+namespace khronos {
+
+    /** A calendar whose dates can be stepped through month by month. */
+    template <class T>
+    concept SteppableCalendar = DayNumberCalendar<T> && requires(year_t& year, month_t& month) {
+        { calendar_traits<T>::days_in_month(year, month) } -> std::convertible_to<day_t>;
+        { calendar_traits<T>::FIRST_MONTH } -> std::convertible_to<month_t>;
+        calendar_traits<T>::next_month(year, month);
+        calendar_traits<T>::previous_month(year, month);
+    };
+
+
+
+    /**	Random-access iterator over the dates of a DateRange.
+        Dereferencing yields a date by value, with the time of day of the range's first date.
+        */
+    template <SteppableCalendar Calendar>
+    class DateIterator {
+        using traits = calendar_traits<Calendar>;
+
+        // Steps of at most this many days are applied incrementally; longer ones decode from the JDN.
+        static constexpr std::int64_t MAX_INCREMENTAL_STEP = 62;
+
+        jdn_t           jdn_{ 0 };
+        std::int64_t    step_{ 1 };
+        year_t          year_{ 0 };
+        month_t         month_{ 1 };
+        day_t           day_{ 1 };
+        day_t           monthLength_{ 31 };     // length of the current month, so that a step costs one compare
+        hour_t          hour_{ 0 };
+        minute_t        minute_{ 0 };
+        second_t        second_{ 0 };
+
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = Calendar;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr DateIterator() = default;
+
+        // Positions the iterator on a date.
+        constexpr DateIterator(Calendar const& date, std::int64_t step)
+            : jdn_(traits::to_jdn(date.year(), date.month(), date.day())), step_(step),
+            year_(date.year()), month_(date.month()), day_(date.day()),
+            monthLength_(traits::days_in_month(date.year(), date.month())),
+            hour_(date.hour()), minute_(date.minute()), second_(date.second()) {}
+
+        // Day number of the current date in the calendar's own day count.
+        constexpr jdn_t jdn() const { return jdn_; }
+
+        constexpr Calendar operator*() const { return Calendar(year_, month_, day_, hour_, minute_, second_); }
+        constexpr Calendar operator[](difference_type n) const { return *(*this + n); }
+
+        constexpr DateIterator& operator++() { advance_days(step_); return *this; }
+        constexpr DateIterator operator++(int) { DateIterator old = *this; ++*this; return old; }
+        constexpr DateIterator& operator--() { advance_days(-step_); return *this; }
+        constexpr DateIterator operator--(int) { DateIterator old = *this; --*this; return old; }
+        constexpr DateIterator& operator+=(difference_type n) { advance_days(n * step_); return *this; }
+        constexpr DateIterator& operator-=(difference_type n) { advance_days(-n * step_); return *this; }
+
+        friend constexpr DateIterator operator+(DateIterator it, difference_type n) { return it += n; }
+        friend constexpr DateIterator operator+(difference_type n, DateIterator it) { return it += n; }
+        friend constexpr DateIterator operator-(DateIterator it, difference_type n) { return it -= n; }
+        friend constexpr difference_type operator-(DateIterator const& lhs, DateIterator const& rhs) {
+            return static_cast<difference_type>((lhs.jdn_ - rhs.jdn_) / lhs.step_);
+        }
+
+        friend constexpr bool operator==(DateIterator const& lhs, DateIterator const& rhs) { return lhs.jdn_ == rhs.jdn_; }
+        friend constexpr auto operator<=>(DateIterator const& lhs, DateIterator const& rhs) {
+            return lhs.step_ < 0 ? rhs.jdn_ <=> lhs.jdn_ : lhs.jdn_ <=> rhs.jdn_;
+        }
+
+    private:
+        // Moves the date by n days.
+        constexpr void advance_days(std::int64_t n) {
+            jdn_ += n;
+            if (n > 0 && n <= MAX_INCREMENTAL_STEP) {
+                day_ += static_cast<day_t>(n);
+                while (day_ > monthLength_) {
+                    day_ -= monthLength_;
+                    traits::next_month(year_, month_);
+                    monthLength_ = traits::days_in_month(year_, month_);
+                }
+            }
+            else if (n < 0 && n >= -MAX_INCREMENTAL_STEP) {
+                day_ += static_cast<day_t>(n);
+                while (day_ < 1) {
+                    traits::previous_month(year_, month_);
+                    monthLength_ = traits::days_in_month(year_, month_);
+                    day_ += monthLength_;
+                }
+            }
+            else if (n != 0) {
+                traits::from_jdn(jdn_, year_, month_, day_);
+                monthLength_ = traits::days_in_month(year_, month_);
+            }
+        }
+    };
+
+
+
+    /**	A lazy view of the dates [first, last) taken every step days.
+        Satisfies std::ranges::random_access_range and std::ranges::sized_range.
+        */
+    template <SteppableCalendar Calendar>
+    class DateRange : public std::ranges::view_interface<DateRange<Calendar>> {
+        DateIterator<Calendar>  first_;
+        DateIterator<Calendar>  last_;      // decoded once, so that end() is free
+        std::ptrdiff_t          size_{ 0 };
+
+    public:
+        constexpr DateRange() = default;
+
+        /**	@param first [in] first date of the range.
+            @param last [in] end of the range (excluded).
+            @param step [in] days between successive dates; may be negative, never zero.
+            */
+        constexpr DateRange(Calendar const& first, Calendar const& last, std::int64_t step = 1) : first_(first, step) {
+            assert(step != 0);
+            using traits = calendar_traits<Calendar>;
+            std::int64_t const span = traits::to_jdn(last.year(), last.month(), last.day()) - first_.jdn();
+            std::int64_t const count = step > 0 ? (span + step - 1) / step : (span + step + 1) / step;
+            size_ = count > 0 ? static_cast<std::ptrdiff_t>(count) : 0;
+            last_ = first_ + size_;
+        }
+
+        constexpr DateIterator<Calendar> begin() const { return first_; }
+        constexpr DateIterator<Calendar> end() const { return last_; }
+        constexpr std::size_t size() const { return static_cast<std::size_t>(size_); }
+    };
+
+    /**	Returns a lazy view of the dates [first, last) taken every step days.
+        @param first [in] first date of the range.
+        @param last [in] end of the range (excluded).
+        @param step [in] days between successive dates; may be negative, never zero.
+        */
+    template <SteppableCalendar Calendar>
+    constexpr DateRange<Calendar> range(Calendar const& first, Calendar const& last, std::int64_t step = 1) {
+        return DateRange<Calendar>(first, last, step);
+    }
+
+} // end-of-namespace khronos
+
+
+
+// A DateRange owns no dates, so its iterators outlive it.
+template <class Calendar>
+inline constexpr bool std::ranges::enable_borrowed_range<khronos::DateRange<Calendar>> = true;
@@ -0,0 +1,465 @@
+#pragma once
+
+/**	@file khronos/recurrence.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library recurrence rules (RFC 5545 RRULE, with the RFC 7529 SKIP option).
+    parse_rrule() compiles a rule once; Recurrence<Calendar> pairs it with a start date and
+    expands it one period (day, week, month or year) at a time, either lazily through its
+    iterator or into a caller's buffer with expand().  Periods are stepped with the calendar's
+    month lengths and the candidates of a period are found from the weekday of its first day,
+    so the expansion never converts through a Jd.
+
+    Supported parts: FREQ (DAILY, WEEKLY, MONTHLY, YEARLY), INTERVAL, COUNT, UNTIL, WKST,
+    BYMONTH, BYMONTHDAY, BYDAY, BYSETPOS, SKIP (OMIT, BACKWARD, FORWARD) and RSCALE (ignored,
+    the calendar is the template argument).  Months use the calendar's own numbering, so
+    BYMONTH=13 is Veadar of a Hebrew leap year.  UNTIL is a Gregorian date; its time is ignored.
+    Occurrences before the start date are never produced and, as in most implementations,
+    the start date is an occurrence only when it matches the rule.
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/calendar.hpp>
+#include <khronos/iso8601.hpp>
+#include <khronos/convert.hpp>
+#include <khronos/range.hpp>
+#include <khronos/workday.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <string_view>
+#include <vector>
+
+
+namespace khronos {
+
+    /** A compiled recurrence rule. */
+    struct RecurrenceRule {
+        enum class Frequency { daily, weekly, monthly, yearly };
+
+        // What a BYMONTHDAY past the end of a month becomes (RFC 7529).
+        enum class Skip { omit, backward, forward };
+
+        // A BYDAY entry: weekday (Monday = 0) and ordinal in the month or year (0 = every).
+        struct WeekdayNum {
+            int ordinal;
+            int weekday;
+        };
+
+        Frequency               frequency{ Frequency::daily };
+        int                     interval{ 1 };
+        std::int64_t            count{ 0 };                                 // 0: unbounded
+        jdn_t                   until{ std::numeric_limits<jdn_t>::max() }; // last day allowed
+        int                     weekStart{ Monday };
+        Skip                    skip{ Skip::omit };
+        std::uint16_t           byMonth{ 0 };       // bit m set for month m
+        std::vector<int>        byMonthDay;         // [1..31] or [-31..-1] from the end of the month
+        std::vector<WeekdayNum> byDay;
+        std::vector<int>        bySetPos;           // [1..366] or [-366..-1] from the end of the period
+    };
+
+    /**	Compiles an RFC 5545 recurrence rule, e.g. "FREQ=MONTHLY;BYDAY=2TU".
+        An "RRULE:" prefix is accepted and names are case-insensitive.
+        @return ParseError::syntax for malformed text, ParseError::invalid_rule for unsupported
+            or contradictory parts, ParseError::none on success.
+        @param text [in] the rule.
+        @param rule [out] the compiled rule.
+        */
+    ParseError parse_rrule(std::string_view text, RecurrenceRule& rule);
+
+
+
+    /**	The occurrences of a recurrence rule from a start date, in the start date's calendar.
+        Every occurrence has the time of day of the start date.
+        */
+    template <SteppableCalendar Calendar>
+    class Recurrence {
+        using traits = calendar_traits<Calendar>;
+
+        // An expansion gives up after this many consecutive periods without an occurrence.
+        static constexpr int MAX_EMPTY_PERIODS = 100'000;
+
+        struct Occurrence {
+            jdn_t   jdn;
+            year_t  year;
+            month_t month;
+            day_t   day;
+        };
+
+        RecurrenceRule  rule_;
+        Calendar        start_;
+        jdn_t           startJdn_;
+        bool            yearByWeekday_{ false };    // YEARLY BYDAY counted through the whole year
+        std::uint8_t    everyWeekday_{ 0 };         // bit d set when every weekday d is wanted (BYDAY without ordinals)
+        std::vector<int> weekOffsets_;              // WEEKLY: days from the week start, ascending
+
+    public:
+        /**	@param rule [in] the compiled rule.
+            @param start [in] first date of the recurrence (DTSTART); also supplies the defaults
+                of the rule (weekday, day of month and month).
+            */
+        Recurrence(RecurrenceRule rule, Calendar const& start)
+            : rule_(std::move(rule)), start_(start), startJdn_(traits::to_jdn(start.year(), start.month(), start.day())) {
+            using Frequency = RecurrenceRule::Frequency;
+            bool const byDay = !rule_.byDay.empty();
+            bool const byMonthDay = !rule_.byMonthDay.empty();
+            if (rule_.frequency == Frequency::weekly && !byDay)
+                rule_.byDay.push_back({ 0, weekday_of_jdn(startJdn_) });
+            if ((rule_.frequency == Frequency::monthly || rule_.frequency == Frequency::yearly) && !byDay && !byMonthDay)
+                rule_.byMonthDay.push_back(start.day());
+            if (rule_.frequency == Frequency::yearly && !byDay && !byMonthDay && rule_.byMonth == 0)
+                rule_.byMonth = static_cast<std::uint16_t>(1u << start.month());
+            yearByWeekday_ = rule_.frequency == Frequency::yearly && byDay && !byMonthDay && rule_.byMonth == 0;
+
+            bool ordinals = false;
+            for (RecurrenceRule::WeekdayNum const& entry : rule_.byDay) {
+                ordinals |= entry.ordinal != 0;
+                everyWeekday_ |= static_cast<std::uint8_t>(1 << entry.weekday);
+            }
+            if (ordinals)
+                everyWeekday_ = 0;
+            for (int offset = 0; offset < 7; ++offset)
+                if (everyWeekday_ >> (rule_.weekStart + offset) % 7 & 1)
+                    weekOffsets_.push_back(offset);
+        }
+
+        // The rule, with the defaults taken from the start date.
+        RecurrenceRule const& rule() const { return rule_; }
+
+        // The start date.
+        Calendar const& start() const { return start_; }
+
+
+
+        /**	Input iterator over the occurrences, in order; compares equal to std::default_sentinel
+            after the last one.
+            */
+        class iterator {
+            Recurrence const*       recurrence_{ nullptr };
+            jdn_t                   limit_{ 0 };        // last day allowed
+            std::int64_t            remaining_{ 0 };    // occurrences left under COUNT
+            DateIterator<Calendar>  day_;               // DAILY: the day; WEEKLY: first day of the week
+            year_t                  year_{ 0 };         // MONTHLY: the month; YEARLY: the year
+            month_t                 month_{ 1 };
+            jdn_t                   monthStart_{ 0 };   // MONTHLY: day number of the month's first day
+            std::vector<Occurrence> period_;            // candidates of the current period
+            std::size_t             next_{ 0 };         // occurrences are period_[next_, end_)
+            std::size_t             end_{ 0 };
+            bool                    done_{ true };
+
+        public:
+            using value_type = Calendar;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            // Positions the iterator on the first occurrence on or before limit.
+            iterator(Recurrence const& recurrence, jdn_t limit)
+                : recurrence_(&recurrence), limit_(std::min(limit, recurrence.rule_.until)),
+                remaining_(recurrence.rule_.count > 0 ? recurrence.rule_.count : std::numeric_limits<std::int64_t>::max()),
+                day_(recurrence.start_, 1), year_(recurrence.start_.year()), month_(recurrence.start_.month()),
+                monthStart_(recurrence.startJdn_ - (recurrence.start_.day() - 1)), done_(false) {
+                if (recurrence.rule_.frequency == RecurrenceRule::Frequency::weekly)
+                    day_ -= (weekday_of_jdn(day_.jdn()) - recurrence.rule_.weekStart + 7) % 7;
+                period_.reserve(32);
+                load();
+            }
+
+            Calendar operator*() const {
+                Occurrence const& o = period_[next_];
+                Calendar const& start = recurrence_->start_;
+                return Calendar(o.year, o.month, o.day, start.hour(), start.minute(), start.second());
+            }
+
+            // Day number of the current occurrence in the calendar's own day count.
+            jdn_t jdn() const { return period_[next_].jdn; }
+
+            iterator& operator++() {
+                if (--remaining_ == 0)
+                    done_ = true;
+                else if (++next_ == end_)
+                    load();
+                return *this;
+            }
+            void operator++(int) { ++*this; }
+
+            friend bool operator==(iterator const& it, std::default_sentinel_t) { return it.done_; }
+
+        private:
+            // Moves to the next period holding an occurrence in [start, limit_].
+            void load() {
+                using Frequency = RecurrenceRule::Frequency;
+                RecurrenceRule const& rule = recurrence_->rule_;
+                for (int empty = 0; empty < MAX_EMPTY_PERIODS; ++empty) {
+                    period_.clear();
+
+                    jdn_t periodStart;
+                    switch (rule.frequency) {
+                    case Frequency::daily:
+                        periodStart = day_.jdn();
+                        if (periodStart > limit_)
+                            break;
+                        recurrence_->day_candidates(*day_, day_.jdn(), period_);
+                        day_ += rule.interval;
+                        break;
+                    case Frequency::weekly:
+                        periodStart = day_.jdn();
+                        if (periodStart > limit_)
+                            break;
+                        recurrence_->week_candidates(day_, period_);
+                        day_ += 7 * static_cast<std::ptrdiff_t>(rule.interval);
+                        break;
+                    case Frequency::monthly:
+                        periodStart = monthStart_;
+                        if (periodStart > limit_)
+                            break;
+                        if (rule.byMonth == 0 || rule.byMonth >> month_ & 1)
+                            recurrence_->month_candidates(year_, month_, periodStart, period_);
+                        for (int i = 0; i < rule.interval; ++i) {
+                            monthStart_ += traits::days_in_month(year_, month_);
+                            traits::next_month(year_, month_);
+                        }
+                        break;
+                    default:
+                        periodStart = traits::to_jdn(year_, traits::FIRST_MONTH, 1);
+                        if (periodStart > limit_)
+                            break;
+                        recurrence_->year_candidates(year_, periodStart, period_);
+                        year_ += rule.interval;
+                        break;
+                    }
+                    if (periodStart > limit_)
+                        break;
+
+                    recurrence_->select(period_);
+                    next_ = 0;
+                    while (next_ < period_.size() && period_[next_].jdn < recurrence_->startJdn_)
+                        ++next_;
+                    end_ = period_.size();
+                    while (end_ > next_ && period_[end_ - 1].jdn > limit_)
+                        --end_;
+                    if (next_ < end_)
+                        return;
+                    if (end_ < period_.size())
+                        break;
+                }
+                done_ = true;
+            }
+        };
+
+        iterator begin() const { return iterator(*this, rule_.until); }
+        std::default_sentinel_t end() const { return {}; }
+
+        /**	Expands the occurrences on or before a horizon into a buffer.
+            @return the number of occurrences written (at most out.size()).
+            @param last [in] the last date that may be produced.
+            @param out [out] the occurrences, in order.
+            */
+        std::size_t expand(Calendar const& last, std::span<Calendar> out) const {
+            std::size_t n = 0;
+            if (out.empty())
+                return n;
+            for (iterator it(*this, traits::to_jdn(last.year(), last.month(), last.day())); it != std::default_sentinel; ++it) {
+                out[n] = *it;
+                if (++n == out.size())
+                    break;
+            }
+            return n;
+        }
+
+        /**	Expands the day numbers of the occurrences on or before a horizon into a buffer.
+            @return the number of occurrences written (at most out.size()).
+            @param last [in] the last day number that may be produced.
+            @param out [out] the day numbers of the occurrences, in order.
+            */
+        std::size_t expand(jdn_t last, std::span<jdn_t> out) const {
+            std::size_t n = 0;
+            if (out.empty())
+                return n;
+            for (iterator it(*this, last); it != std::default_sentinel; ++it) {
+                out[n] = it.jdn();
+                if (++n == out.size())
+                    break;
+            }
+            return n;
+        }
+
+    private:
+        // True if day of a month of length days matches a BYMONTHDAY entry.
+        static bool matches_month_day(int monthDay, day_t day, day_t length) {
+            return monthDay > 0 ? day == monthDay : day == length + 1 + monthDay;
+        }
+
+        // True if the day (weekday, in a month of length days) matches a BYDAY entry.
+        static bool matches_weekday(RecurrenceRule::WeekdayNum const& entry, int weekday, day_t day, day_t length) {
+            if (entry.weekday != weekday)
+                return false;
+            if (entry.ordinal > 0)
+                return (day - 1) / 7 + 1 == entry.ordinal;
+            if (entry.ordinal < 0)
+                return (length - day) / 7 + 1 == -entry.ordinal;
+            return true;
+        }
+
+        // DAILY: the day itself, if it passes the BYMONTH, BYMONTHDAY and BYDAY filters.
+        void day_candidates(Calendar const& date, jdn_t jdn, std::vector<Occurrence>& out) const {
+            if (rule_.byMonth != 0 && !(rule_.byMonth >> date.month() & 1))
+                return;
+            if (!rule_.byMonthDay.empty()) {
+                day_t const length = traits::days_in_month(date.year(), date.month());
+                if (std::none_of(rule_.byMonthDay.begin(), rule_.byMonthDay.end(),
+                    [&](int monthDay) { return matches_month_day(monthDay, date.day(), length); }))
+                    return;
+            }
+            int const weekday = weekday_of_jdn(jdn);
+            if (!rule_.byDay.empty() && std::none_of(rule_.byDay.begin(), rule_.byDay.end(),
+                [&](RecurrenceRule::WeekdayNum const& entry) { return entry.weekday == weekday; }))
+                return;
+            out.push_back({ jdn, date.year(), date.month(), date.day() });
+        }
+
+        // WEEKLY: the BYDAY weekdays of the week starting at weekStart, filtered by BYMONTH.
+        void week_candidates(DateIterator<Calendar> const& weekStart, std::vector<Occurrence>& out) const {
+            DateIterator<Calendar> it = weekStart;
+            int at = 0;
+            for (int offset : weekOffsets_) {
+                it += offset - at;
+                at = offset;
+                Calendar const date = *it;
+                if (rule_.byMonth == 0 || rule_.byMonth >> date.month() & 1)
+                    out.push_back({ it.jdn(), date.year(), date.month(), date.day() });
+            }
+        }
+
+        // The BYMONTHDAY and BYDAY days of a month (BYDAY limits BYMONTHDAY when both are given).
+        void month_candidates(year_t year, month_t month, jdn_t monthStart, std::vector<Occurrence>& out) const {
+            day_t const length = traits::days_in_month(year, month);
+            int const firstWeekday = weekday_of_jdn(monthStart);
+            auto push = [&](day_t day) { out.push_back({ monthStart + day - 1, year, month, day }); };
+
+            if (!rule_.byMonthDay.empty()) {
+                for (int monthDay : rule_.byMonthDay) {
+                    day_t day = static_cast<day_t>(monthDay > 0 ? monthDay : length + 1 + monthDay);
+                    if (day < 1)
+                        continue;
+                    if (day > length) {
+                        if (rule_.skip == RecurrenceRule::Skip::omit)
+                            continue;
+                        if (rule_.skip == RecurrenceRule::Skip::forward) {
+                            year_t nextYear = year;
+                            month_t nextMonth = month;
+                            traits::next_month(nextYear, nextMonth);
+                            out.push_back({ monthStart + length, nextYear, nextMonth, 1 });
+                            continue;
+                        }
+                        day = length;
+                    }
+                    int const weekday = (firstWeekday + day - 1) % 7;
+                    if (!rule_.byDay.empty() && std::none_of(rule_.byDay.begin(), rule_.byDay.end(),
+                        [&](RecurrenceRule::WeekdayNum const& entry) { return matches_weekday(entry, weekday, day, length); }))
+                        continue;
+                    push(day);
+                }
+            }
+            else if (everyWeekday_ != 0) {
+                // Scanned in day order, so the period needs no sort.
+                int weekday = firstWeekday;
+                for (day_t day = 1; day <= length; ++day) {
+                    if (everyWeekday_ >> weekday & 1)
+                        push(day);
+                    if (++weekday == 7)
+                        weekday = 0;
+                }
+            }
+            else {
+                for (RecurrenceRule::WeekdayNum const& entry : rule_.byDay) {
+                    day_t const first = static_cast<day_t>(1 + (entry.weekday - firstWeekday + 7) % 7);
+                    if (entry.ordinal == 0)
+                        for (day_t day = first; day <= length; day += 7)
+                            push(day);
+                    else if (entry.ordinal > 0) {
+                        day_t const day = first + 7 * (entry.ordinal - 1);
+                        if (day <= length)
+                            push(day);
+                    }
+                    else {
+                        day_t const day = first + 7 * ((length - first) / 7 + entry.ordinal + 1);
+                        if (day >= 1)
+                            push(day);
+                    }
+                }
+            }
+        }
+
+        // YEARLY: the months of the year (BYMONTH), or BYDAY counted through the whole year.
+        void year_candidates(year_t year, jdn_t yearStart, std::vector<Occurrence>& out) const {
+            if (!yearByWeekday_) {
+                year_t y = year;
+                month_t month = traits::FIRST_MONTH;
+                jdn_t monthStart = yearStart;
+                do {
+                    if (rule_.byMonth == 0 || rule_.byMonth >> month & 1)
+                        month_candidates(y, month, monthStart, out);
+                    monthStart += traits::days_in_month(y, month);
+                    traits::next_month(y, month);
+                } while (y == year);
+                return;
+            }
+
+            jdn_t const length = traits::to_jdn(year + 1, traits::FIRST_MONTH, 1) - yearStart;
+            int const firstWeekday = weekday_of_jdn(yearStart);
+            auto push = [&](jdn_t jdn) {
+                Occurrence o{ jdn, 0, 1, 1 };
+                traits::from_jdn(jdn, o.year, o.month, o.day);
+                out.push_back(o);
+            };
+            for (RecurrenceRule::WeekdayNum const& entry : rule_.byDay) {
+                jdn_t const first = (entry.weekday - firstWeekday + 7) % 7;
+                if (entry.ordinal == 0)
+                    for (jdn_t offset = first; offset < length; offset += 7)
+                        push(yearStart + offset);
+                else if (entry.ordinal > 0) {
+                    jdn_t const offset = first + 7 * (entry.ordinal - 1);
+                    if (offset < length)
+                        push(yearStart + offset);
+                }
+                else {
+                    jdn_t const offset = first + 7 * ((length - 1 - first) / 7 + entry.ordinal + 1);
+                    if (offset >= 0)
+                        push(yearStart + offset);
+                }
+            }
+        }
+
+        // Orders the candidates of a period, drops duplicates and applies BYSETPOS.
+        void select(std::vector<Occurrence>& period) const {
+            if (period.size() < 2 && rule_.bySetPos.empty())
+                return;
+            auto const before = [](Occurrence const& a, Occurrence const& b) { return a.jdn < b.jdn; };
+            auto const same = [](Occurrence const& a, Occurrence const& b) { return a.jdn == b.jdn; };
+            if (!std::is_sorted(period.begin(), period.end(), before))
+                std::sort(period.begin(), period.end(), before);
+            period.erase(std::unique(period.begin(), period.end(), same), period.end());
+            if (rule_.bySetPos.empty() || period.empty())
+                return;
+
+            // The chosen candidates are appended, then the whole set is dropped; period keeps its capacity.
+            int const size = static_cast<int>(period.size());
+            for (int position : rule_.bySetPos) {
+                int const i = position > 0 ? position - 1 : size + position;
+                if (i >= 0 && i < size) {
+                    Occurrence const chosen = period[static_cast<std::size_t>(i)];
+                    period.push_back(chosen);
+                }
+            }
+            period.erase(period.begin(), period.begin() + size);
+            std::sort(period.begin(), period.end(), before);
+            period.erase(std::unique(period.begin(), period.end(), same), period.end());
+        }
+    };
+
+} // end-of-namespace khronos
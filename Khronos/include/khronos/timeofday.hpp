@@ -33,7 +33,10 @@ namespace khronos {
 	constexpr int SECONDS_PER_DAY = 24 * 60 * 60;
 
 
-	double tod(hour_t hour, minute_t minute, second_t second);
+	/** Converts a time of day to the fraction of the day elapsed since midnight. */
+	constexpr double tod(hour_t hour, minute_t minute, second_t second) {
+		return (hour * 3600 + minute * 60 + second) / (24.0 * 60 * 60);
+	}
 
 	/**	Convert Time-of-day (TOD) to hours, minutes, seconds.  Civil days run from midnight to midnight.
 		@param tod [in] a time-of-day [0..1)
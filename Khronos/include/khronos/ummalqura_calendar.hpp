@@ -0,0 +1,392 @@
+#pragma once
+
+/**	@file khronos/ummalqura_calendar.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library Umm al-Qura calendar.
+    The Saudi Umm al-Qura calendar is observational, so its months are looked up in a table
+    instead of computed.  The table keeps one bit per month (set for a 30-day month) and the
+    JDN of 1 Muharram every 16 years; a month start is its block's anchor plus 29 days a month
+    plus the popcount of at most three words, so conversions run in constant time both ways.
+
+    The built-in table covers 1300-1600 AH (1882-2174 CE) and joins the civil tabular calendar
+    at both ends; outside a table's years UmmAlQura dates follow the civil tabular calendar.
+    A table can also be memory-mapped from a binary file (UmmAlQuraTableFile) and selected
+    with set_ummalqura_table().
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/julian_day.hpp>
+#include <khronos/islamic_calendar.hpp>
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+
+namespace khronos {
+
+    /**	A packed Umm al-Qura month-length table.
+        Bit 12 k + (m - 1) of a block's three words is set when month m of the block's k-th year
+        has 30 days; anchors[b] is the JDN of 1 Muharram of the first year of block b.  The table
+        does not own its data.
+        */
+    class UmmAlQuraTable {
+    public:
+        static constexpr int YEARS_PER_BLOCK = 16;                          // years between anchors
+        static constexpr int MONTHS_PER_BLOCK = 12 * YEARS_PER_BLOCK;       // 192 bits
+        static constexpr int WORDS_PER_BLOCK = MONTHS_PER_BLOCK / 64;
+
+        constexpr UmmAlQuraTable() = default;
+
+        /**	@param first_year [in] Islamic year of the first table entry.
+            @param year_count [in] number of years in the table.
+            @param anchors [in] JDN of 1 Muharram of every block's first year.
+            @param months [in] WORDS_PER_BLOCK words of month bits per block.
+            */
+        constexpr UmmAlQuraTable(year_t first_year, year_t year_count, std::span<std::int32_t const> anchors, std::span<std::uint64_t const> months)
+            : firstYear_(first_year), yearCount_(year_count), anchors_(anchors), months_(months) {
+            endJdn_ = sizes_match() ? month_start(yearCount_ * 12) : first_jdn();
+        }
+
+        constexpr year_t first_year() const { return firstYear_; }
+        constexpr year_t last_year() const { return firstYear_ + yearCount_ - 1; }
+        constexpr jdn_t first_jdn() const { return anchors_.empty() ? 0 : anchors_[0]; }
+        constexpr jdn_t end_jdn() const { return endJdn_; }     // the day after the table
+        constexpr std::span<std::int32_t const> anchors() const { return anchors_; }
+        constexpr std::span<std::uint64_t const> months() const { return months_; }
+
+        constexpr bool contains_year(year_t year) const { return year >= firstYear_ && year - firstYear_ < yearCount_; }
+        constexpr bool contains_jdn(jdn_t jdn) const { return jdn >= first_jdn() && jdn < endJdn_; }
+
+        // Checks the sizes, that every anchor follows from the month bits, and that the padding is clear.
+        constexpr bool valid() const {
+            if (!sizes_match())
+                return false;
+            for (std::int64_t b = 0; b + 1 < static_cast<std::int64_t>(anchors_.size()); ++b)
+                if (anchor(b + 1) != anchor(b) + 29 * MONTHS_PER_BLOCK + long_months_before(b, MONTHS_PER_BLOCK))
+                    return false;
+            std::int64_t const used = yearCount_ * 12 - static_cast<std::int64_t>(anchors_.size() - 1) * MONTHS_PER_BLOCK;
+            std::span<std::uint64_t const> const last = months_.last(WORDS_PER_BLOCK);
+            for (int i = 0; i < WORDS_PER_BLOCK; ++i) {
+                std::int64_t const bits = std::clamp<std::int64_t>(used - 64 * i, 0, 64);
+                if (bits < 64 && last[i] >> bits != 0)
+                    return false;
+            }
+            return true;
+        }
+
+        /**	Returns the JDN of the first day of a month.
+            @param index [in] months since 1 Muharram of the first year [0..12 year_count].
+            */
+        constexpr jdn_t month_start(std::int64_t index) const {
+            std::int64_t block = index / MONTHS_PER_BLOCK;
+            std::int64_t month = index % MONTHS_PER_BLOCK;
+            if (block == static_cast<std::int64_t>(anchors_.size())) {
+                --block;
+                month = MONTHS_PER_BLOCK;
+            }
+            return anchor(block) + 29 * month + long_months_before(block, month);
+        }
+
+        /**	Returns the index of the month containing a day.
+            @param jdn [in] a day in [first_jdn()..end_jdn()).
+            @param day [out] day of the month [1..30]
+            */
+        constexpr std::int64_t month_of(jdn_t jdn, day_t& day) const {
+            // Observed blocks are 5669 to 5671 days long, so the first estimate is off by at most one block.
+            // valid() does not bound the month lengths, so the corrections loop until the day is covered.
+            std::int64_t const lastBlock = static_cast<std::int64_t>(anchors_.size()) - 1;
+            std::int64_t block = std::min<std::int64_t>((jdn - first_jdn()) / 5'670, lastBlock);
+            while (block > 0 && anchor(block) > jdn)
+                --block;
+            while (block < lastBlock && anchor(block + 1) <= jdn)
+                ++block;
+
+            // Observed month starts stay within a few days of the mean lunation (29.5306 days), so the estimate is off by at most one month.
+            jdn_t const offset = jdn - anchor(block);
+            std::int64_t const first = block * MONTHS_PER_BLOCK;
+            std::int64_t month = std::min<std::int64_t>(offset * 10'000 / 295'306, MONTHS_PER_BLOCK - 1);
+            jdn_t start = 29 * month + long_months_before(block, month);
+            while (offset < start) {
+                --month;
+                start -= month_length(first + month);
+            }
+            while (offset - start >= month_length(first + month)) {
+                start += month_length(first + month);
+                ++month;
+            }
+            day = static_cast<day_t>(offset - start + 1);
+            return first + month;
+        }
+
+        /**	Returns the length of a month (29 or 30 days).
+            @param index [in] months since 1 Muharram of the first year.
+            */
+        constexpr day_t month_length(std::int64_t index) const {
+            std::uint64_t const word = months_[static_cast<std::size_t>(index / 64)];
+            return static_cast<day_t>(29 + (word >> (index % 64) & 1));
+        }
+
+    private:
+        year_t                          firstYear_{ 0 };
+        year_t                          yearCount_{ 0 };
+        std::span<std::int32_t const>   anchors_;
+        std::span<std::uint64_t const>  months_;
+        jdn_t                           endJdn_{ 0 };
+
+        constexpr bool sizes_match() const {
+            std::size_t const blocks = static_cast<std::size_t>((yearCount_ + YEARS_PER_BLOCK - 1) / YEARS_PER_BLOCK);
+            return yearCount_ > 0 && anchors_.size() == blocks && months_.size() == blocks * WORDS_PER_BLOCK;
+        }
+
+        constexpr jdn_t anchor(std::int64_t block) const { return anchors_[static_cast<std::size_t>(block)]; }
+
+        // Number of 30-day months among the first n months [0..192] of a block.
+        constexpr jdn_t long_months_before(std::int64_t block, std::int64_t n) const {
+            std::uint64_t const* words = months_.data() + block * WORDS_PER_BLOCK;
+            jdn_t count = 0;
+            for (; n >= 64; n -= 64)
+                count += std::popcount(*words++);
+            if (n > 0)
+                count += std::popcount(*words & ((std::uint64_t(1) << n) - 1));
+            return count;
+        }
+    };
+
+
+
+    namespace ummalqura_data {
+        // Umm al-Qura month lengths for 1300-1600 AH, as published in the Unicode CLDR/ICU data.
+        constexpr year_t FIRST_YEAR = 1300;
+        constexpr year_t YEAR_COUNT = 301;
+        inline constexpr std::int32_t ANCHORS[] = {
+            2'408'762, 2'414'432, 2'420'102, 2'425'772, 2'431'442, 2'437'112,
+            2'442'781, 2'448'451, 2'454'121, 2'459'791, 2'465'461, 2'471'130,
+            2'476'801, 2'482'471, 2'488'140, 2'493'810, 2'499'480, 2'505'150,
+            2'510'820,
+        };
+        inline constexpr std::uint64_t MONTHS[] = {
+            0xC5762B69372AB555, 0x5D49E956AAAB5536, 0xA96B4B3AA5B52BA9,
+            0x5752B5A56D2AD52E, 0xB4AB5A56D16E8AF2, 0xA9B64BB25B92DA96,
+            0x5D4ADA55D46D935A, 0xD46E92F4975536A9, 0x9BA4BD25D5356A96,
+            0xD4ADA55B2AB693B4, 0x2AE94EAA6D92DAA5, 0xD5556AA6D4AEC56D,
+            0x553AA5B52BA93D4A, 0xADA55D29D52EA96B, 0xDA2ED16E4AEA56D4,
+            0x4BB25B92DA95AAAA, 0xBA4DB2AB5556C976, 0x92DAA5D52DA95B4A,
+            0xBAA5AD52DA8ED26D, 0x699752B6937497A4, 0x4DB25B92BC95D52D,
+            0xDA95D4ADA55D29D5, 0x89BC4BD23AAAAD54, 0x6D4B6A5AD52DA95B,
+            0xD2AE956AA6D92DC9, 0x9D94DAAAB5536A56, 0xD555AA5B52BA95D4,
+            0x4ADA55D26E92EA9A, 0x6D4ADA4DB276A56D, 0xD26E92F49754B5A5,
+            0x5B92BAA6B5356A56, 0xB4ADA55AA9B68BB2, 0x276536A9AB52DA95,
+            0xD5556A96D4AF2575, 0x52B695749BA4BD2A, 0xAD94DAA5D52DA95B,
+            0xD92EC96E2AE956B2, 0x2BD15D4AD6556AAA, 0xD64DB26B553AC5B6,
+            0x8AEA96D4ADA55D29, 0xDAA6AD4ADA4ED16E, 0x6556D1B68B725B92,
+            0x2DA95B52BA95B4AB, 0xDA95D46E94ECA6D5, 0x93749BA4DAAAAD54,
+            0xBAA5D52D6A9754B6, 0xC55D2AD955B2AB94, 0x5B4AB5555B25D92D,
+            0x6AAB5937457A2BA9, 0x95B4ABA55D29D64D, 0x5B49DA2DD15D4ADA,
+            0xD1768B725B52D5A9, 0x5B52BA96ACAB6A56, 0xD46B94DAA5B62BB1,
+            0x975555AA9D52DA8D, 0xB5556A96E4AF1374, 0x000000000B94BAA6,
+        };
+    }
+
+    /** The built-in table (1300-1600 AH). */
+    inline constexpr UmmAlQuraTable UMMALQURA_TABLE{ ummalqura_data::FIRST_YEAR, ummalqura_data::YEAR_COUNT, ummalqura_data::ANCHORS, ummalqura_data::MONTHS };
+    static_assert(UMMALQURA_TABLE.valid());
+
+    /** Returns the table used by the UmmAlQura class and the table-less functions. */
+    UmmAlQuraTable const& ummalqura_table();
+
+    /**	Selects the table used by the UmmAlQura class and the table-less functions.
+        @param table [in] the new table, or nullptr for UMMALQURA_TABLE; it must outlive its use.
+        @return the previously selected table.
+        */
+    UmmAlQuraTable const* set_ummalqura_table(UmmAlQuraTable const* table);
+
+
+
+    /**	Converts an Umm al-Qura date to its Julian Day Number.
+        @return the JDN of the day (JD of midnight + 0.5).
+        @param table [in] month-length table; years outside it use the civil tabular calendar.
+        @param year [in] Islamic year
+        @param month [in] month number [1..12]
+        @param day [in] day of the month [1..30]
+        */
+    constexpr jdn_t ummalqura_to_jdn(UmmAlQuraTable const& table, year_t year, month_t month, day_t day) {
+        if (!table.contains_year(year))
+            return islamic_to_jdn(year, month, day);
+        return table.month_start((year - table.first_year()) * 12 + month - 1) + day - 1;
+    }
+
+    /**	Converts a Julian Day Number to an Umm al-Qura date.
+        @param table [in] month-length table; days outside it use the civil tabular calendar.
+        @param jdn [in] Julian Day Number
+        @param year [out] Islamic year
+        @param month [out] month number [1..12]
+        @param day [out] day of the month [1..30]
+        */
+    constexpr void jdn_to_ummalqura(UmmAlQuraTable const& table, jdn_t jdn, year_t& year, month_t& month, day_t& day) {
+        if (!table.contains_jdn(jdn)) {
+            jdn_to_islamic(jdn, year, month, day);
+            return;
+        }
+        std::int64_t const index = table.month_of(jdn, day);
+        year = table.first_year() + index / 12;
+        month = static_cast<month_t>(index % 12 + 1);
+    }
+
+    // Returns the number of days in an Umm al-Qura month.
+    constexpr day_t ummalqura_days_in_month(UmmAlQuraTable const& table, year_t year, month_t month) {
+        if (!table.contains_year(year))
+            return static_cast<day_t>(islamic_month_length(year, month));
+        return table.month_length((year - table.first_year()) * 12 + month - 1);
+    }
+
+    // Converts an Umm al-Qura date to its Julian Day Number with the selected table.
+    inline jdn_t ummalqura_to_jdn(year_t year, month_t month, day_t day) {
+        return ummalqura_to_jdn(ummalqura_table(), year, month, day);
+    }
+
+    // Converts a Julian Day Number to an Umm al-Qura date with the selected table.
+    inline void jdn_to_ummalqura(jdn_t jdn, year_t& year, month_t& month, day_t& day) {
+        jdn_to_ummalqura(ummalqura_table(), jdn, year, month, day);
+    }
+
+    // Returns the number of days in an Umm al-Qura month of the selected table.
+    inline day_t ummalqura_days_in_month(year_t year, month_t month) {
+        return ummalqura_days_in_month(ummalqura_table(), year, month);
+    }
+
+    // Converts an Umm al-Qura date to the Julian Day of its midnight.
+    inline jd_t ummalqura_to_jd(year_t year, month_t month, day_t day) {
+        return static_cast<jd_t>(ummalqura_to_jdn(year, month, day)) - 0.5;
+    }
+
+    // Converts an Umm al-Qura date with time components to a Julian Day.
+    inline jd_t ummalqura_to_jd(year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second) {
+        double tod_ = tod(hour, minute, second);
+        if (tod_ >= 0.5)
+            tod_ -= 1;  // the day turns over at noon, as in the tabular calendar
+        return ummalqura_to_jd(year, month, day) + tod_;
+    }
+
+    // Converts a Julian Day to an Umm al-Qura date.
+    inline void jd_to_ummalqura(jd_t jd, year_t& year, month_t& month, day_t& day) {
+        jdn_to_ummalqura(utility::ifloor(jd) + 1, year, month, day);
+    }
+
+    // Converts a Julian Day to an Umm al-Qura date with time components.
+    inline void jd_to_ummalqura(jd_t jd, year_t& year, month_t& month, day_t& day, hour_t& hour, minute_t& minute, second_t& second) {
+        jd_to_ummalqura(jd, year, month, day);
+        double const tod = (jd + 0.5) - static_cast<double>(utility::ifloor(jd + 0.5));
+        int const secondsInDay = static_cast<int>(utility::ifloor(tod * SECONDS_PER_DAY + 0.5));
+        hour = secondsInDay / 3600;
+        minute = (secondsInDay / 60) % 60;
+        second = secondsInDay % 60;
+    }
+
+
+
+    /**	Date in the Umm al-Qura calendar, converted with the selected table.
+        Months have the Islamic names (islamic_month_name).
+        */
+    class UmmAlQura {
+    public:
+        year_t year_;
+        month_t month_;
+        day_t day_;
+        hour_t hour_{ 0 };
+        minute_t minute_{ 0 };
+        second_t second_{ 0.0 };
+
+        UmmAlQura();                // Default constructor: the current local time.
+        UmmAlQura(now_t option);    // Constructor with current time option.
+
+        // Constructor with year, month, day, and optional time.
+        constexpr UmmAlQura(year_t y, month_t m, day_t d, hour_t h = 0, minute_t mi = 0, second_t s = 0)
+            : year_(y), month_(m), day_(d), hour_(h), minute_(mi), second_(s) {}
+
+        constexpr bool operator==(UmmAlQura const& other) const {
+            return year_ == other.year_ && month_ == other.month_ && day_ == other.day_ &&
+                hour_ == other.hour_ && minute_ == other.minute_ && second_ == other.second_;
+        }
+
+        // Converts the date to a Julian Day.
+        jd_t to_jd() const { return ummalqura_to_jd(year_, month_, day_, hour_, minute_, second_); }
+
+        constexpr year_t year() const { return year_; }
+        constexpr month_t month() const { return month_; }
+        constexpr day_t day() const { return day_; }
+        constexpr hour_t hour() const { return hour_; }
+        constexpr minute_t minute() const { return minute_; }
+        constexpr second_t second() const { return second_; }
+
+        operator Jd() const { return Jd(to_jd()); }
+    };
+
+    /**	Adds a number of months to an Umm al-Qura date.
+        The day is clamped to the length of the resulting month.
+        @param n [in] signed month offset
+        @return the shifted date, with the time of day unchanged.
+        */
+    inline UmmAlQura add_months(UmmAlQura const& date, std::int64_t n) {
+        std::int64_t const index = (date.year_ - 1) * 12 + (date.month_ - 1) + n;
+        year_t const year = (index >= 0 ? index : index - 11) / 12 + 1;
+        month_t const month = static_cast<month_t>(index - (year - 1) * 12 + 1);
+        day_t const day = std::min(date.day_, ummalqura_days_in_month(year, month));
+        return UmmAlQura(year, month, day, date.hour_, date.minute_, date.second_);
+    }
+
+    /**	Adds a number of days to an Umm al-Qura date.
+        @param n [in] signed day offset
+        @return the shifted date, with the time of day unchanged.
+        */
+    inline UmmAlQura add_days(UmmAlQura const& date, std::int64_t n) {
+        year_t year{};
+        month_t month{};
+        day_t day{};
+        jdn_to_ummalqura(ummalqura_to_jdn(date.year_, date.month_, date.day_) + n, year, month, day);
+        return UmmAlQura(year, month, day, date.hour_, date.minute_, date.second_);
+    }
+
+
+
+    /**	An Umm al-Qura table memory-mapped from a binary file.
+        The file holds, in native byte order: the characters "KUQT", a 32-bit version (1), the
+        32-bit first year and year count, the 32-bit anchors (zero-padded to a multiple of 8
+        bytes) and the 64-bit month words.  write_ummalqura_table() produces it.
+        */
+    class UmmAlQuraTableFile {
+    public:
+        UmmAlQuraTableFile() = default;
+
+        // Maps the file; is_open() is false if it cannot be mapped or is not a valid table.
+        explicit UmmAlQuraTableFile(std::string const& path);
+        ~UmmAlQuraTableFile();
+
+        UmmAlQuraTableFile(UmmAlQuraTableFile&& other) noexcept;
+        UmmAlQuraTableFile& operator=(UmmAlQuraTableFile&& other) noexcept;
+        UmmAlQuraTableFile(UmmAlQuraTableFile const&) = delete;
+        UmmAlQuraTableFile& operator=(UmmAlQuraTableFile const&) = delete;
+
+        bool is_open() const { return view_ != nullptr; }
+
+        // The mapped table; valid while the file is open.
+        UmmAlQuraTable const& table() const { return table_; }
+
+    private:
+        void const*     view_{ nullptr };
+        std::size_t     size_{ 0 };
+        UmmAlQuraTable  table_;
+
+        void close();
+    };
+
+    /**	Writes a table in the UmmAlQuraTableFile format.
+        @return true if the file was written.
+        */
+    bool write_ummalqura_table(std::string const& path, UmmAlQuraTable const& table);
+
+} // end-of-namespace khronos
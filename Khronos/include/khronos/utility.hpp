@@ -8,6 +8,12 @@ namespace khronos {
 	namespace utility {
 		inline double mod(double a, double b) { return a - b * floor(a / b); }
 		inline double jwday(double j) { return mod(floor(j + 1.5), 7.0); }
+
+		/** Largest integer not greater than x: std::floor usable in constant expressions (|x| < 2^63). */
+		constexpr long long ifloor(double x) {
+			long long const i = static_cast<long long>(x);
+			return static_cast<double>(i) > x ? i - 1 : i;
+		}
 	}
 
 } // end-of-namespace khronos
\ No newline at end of file
@@ -0,0 +1,108 @@
+#pragma once
+
+/**	@file khronos/workday.hpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Khronos library business-day calendar.
+    A WorkdayCalendar counts, adds and subtracts business days in constant time.  Outside
+    the span of its holidays, days are counted by whole weeks plus a table lookup; inside it,
+    a bitmap of the business days with a running count per 64-day word answers the same
+    questions with a popcount.
+
+    Days are the civil days (midnight to midnight) holding a Jd; weekdays are numbered
+    Monday = 0 .. Sunday = 6 as in civil_weekday_codes_long.
+    */
+
+#include <khronos/def.hpp>
+#include <khronos/calendar.hpp>
+#include <khronos/julian_day.hpp>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+
+namespace khronos {
+
+    /** Set of weekend days: bit d is set when weekday d (Monday = 0) is not a working day. */
+    using WeekendMask = std::uint8_t;
+
+    constexpr WeekendMask WEEKEND_SATURDAY_SUNDAY = 1 << Saturday | 1 << Sunday;
+    constexpr WeekendMask WEEKEND_FRIDAY_SATURDAY = 1 << Friday | 1 << Saturday;
+    constexpr WeekendMask WEEKEND_SUNDAY = 1 << Sunday;
+
+    // Returns the weekday of a JDN (Monday = 0).
+    constexpr int weekday_of_jdn(jdn_t jdn) {
+        jdn_t const d = jdn % 7;
+        return static_cast<int>(d < 0 ? d + 7 : d);
+    }
+
+
+
+    /**	Business-day calendar: a weekend mask and a set of holidays. */
+    class WorkdayCalendar {
+    public:
+        /**	@param weekend [in] days of the week that are not worked; at least one day must be worked.
+            @param holidays [in] non-working days, in any order; those falling on a weekend are ignored.
+            */
+        explicit WorkdayCalendar(WeekendMask weekend = WEEKEND_SATURDAY_SUNDAY, std::span<Jd const> holidays = {});
+
+        // The weekend mask.
+        WeekendMask weekend() const { return weekend_; }
+
+        // True if the day holding jd is a business day.
+        bool is_workday(Jd jd) const { return is_workday_jdn(to_jdn(jd)); }
+
+        /**	Counts the business days in [first, last); negative when last is before first.
+            @param first [in] first day counted.
+            @param last [in] first day not counted.
+            */
+        std::int64_t count(Jd first, Jd last) const { return rank(to_jdn(last)) - rank(to_jdn(first)); }
+
+        /**	Moves a date by business days.
+            @return the n-th business day after (n > 0) or before (n < 0) the day of date,
+                at the same time of day; date itself when n == 0.
+            */
+        Jd add(Jd date, std::int64_t n) const;
+
+        // Moves a date n business days back.
+        Jd subtract(Jd date, std::int64_t n) const { return add(date, -n); }
+
+        /**	Counts business days for columns of intervals.
+            @pre all spans have the same size.
+            @param out [out] out[i] == count(first[i], last[i])
+            */
+        void count(std::span<Jd const> first, std::span<Jd const> last, std::span<std::int64_t> out) const;
+
+        /**	Moves columns of dates by business days.
+            @pre all spans have the same size.
+            @param out [out] out[i] == add(dates[i], n[i])
+            */
+        void add(std::span<Jd const> dates, std::span<std::int64_t const> n, std::span<Jd> out) const;
+
+    private:
+        static constexpr std::int64_t SELECT_SAMPLE = 64;   // business days between select samples
+
+        WeekendMask     weekend_;
+        int             workdaysPerWeek_;
+        std::array<std::array<std::int8_t, 8>, 7> workdaysIn_{};    // [weekday][n]: business days in the n days starting on weekday
+        std::array<std::array<std::int8_t, 7>, 7> nthWorkday_{};    // [weekday][k]: offset of the k-th business day on or after weekday
+
+        // Holiday span [first_, last_) as a business-day bitmap.
+        jdn_t                       first_{ 0 };
+        jdn_t                       last_{ 0 };
+        std::vector<std::uint64_t>  bits_;          // bit i set when first_ + i is a business day
+        std::vector<std::int64_t>   rank_;          // business days before each word; one extra entry for the end
+        std::vector<std::uint32_t>  select_;        // word holding business day k * SELECT_SAMPLE of the span
+
+        static jdn_t to_jdn(Jd jd) { return utility::ifloor(jd.jd() + 0.5); }
+
+        bool is_workday_jdn(jdn_t jdn) const;
+        std::int64_t weekdays(jdn_t from, jdn_t to) const;
+        jdn_t nth_weekday(jdn_t from, std::int64_t k) const;
+        std::int64_t rank(jdn_t jdn) const;
+        jdn_t select(std::int64_t k) const;
+    };
+
+} // end-of-namespace khronos
@@ -0,0 +1,86 @@
+/**	@file batch.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Batch conversion instruction set detection and selection.
+    */
+
+#include <khronos/batch.hpp>
+#include <atomic>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define KHRONOS_BATCH_X86 1
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#endif
+#endif
+
+
+namespace khronos::batch {
+
+    namespace {
+        // Queries the processor (and operating system support for the wide registers).
+        Isa detect_isa() {
+#if defined(KHRONOS_BATCH_X86) && defined(_MSC_VER)
+            int regs[4];
+            __cpuid(regs, 0);
+            if (regs[0] < 7)
+                return Isa::scalar;
+
+            __cpuid(regs, 1);
+            bool const osxsave = (regs[2] & (1 << 27)) != 0;
+            bool const avx = (regs[2] & (1 << 28)) != 0;
+            if (!osxsave || !avx)
+                return Isa::scalar;
+            auto const xcr0 = _xgetbv(0);
+
+            __cpuidex(regs, 7, 0);
+            bool const avx2 = (regs[1] & (1 << 5)) != 0;
+            bool const avx512f = (regs[1] & (1 << 16)) != 0;
+
+            if (avx512f && (xcr0 & 0xE6) == 0xE6)   // XMM, YMM, opmask, ZMM state
+                return Isa::avx512;
+            if (avx2 && (xcr0 & 0x6) == 0x6)        // XMM, YMM state
+                return Isa::avx2;
+            return Isa::scalar;
+#elif defined(KHRONOS_BATCH_X86)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f"))
+                return Isa::avx512;
+            if (__builtin_cpu_supports("avx2"))
+                return Isa::avx2;
+            return Isa::scalar;
+#else
+            return Isa::scalar;
+#endif
+        }
+
+        std::atomic<Isa>& active() {
+            static std::atomic<Isa> isa{ detected_isa() };
+            return isa;
+        }
+    }
+
+
+
+    // Returns the best instruction set available, detected once.
+    Isa detected_isa() {
+        static Isa const isa = detect_isa();
+        return isa;
+    }
+
+    // Returns the instruction set the batch kernels currently use.
+    Isa active_isa() {
+        return active().load(std::memory_order_relaxed);
+    }
+
+    // Selects the instruction set, lowering requests the processor cannot honour.
+    Isa set_active_isa(Isa isa) {
+        if (static_cast<int>(isa) > static_cast<int>(detected_isa()))
+            isa = detected_isa();
+        active().store(isa, std::memory_order_relaxed);
+        return isa;
+    }
+
+} // end-of-namespace khronos::batch
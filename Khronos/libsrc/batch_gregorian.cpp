@@ -0,0 +1,432 @@
+/**	@file batch_gregorian.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Gregorian calendar batch conversion implementations.
+
+    The vector kernels evaluate gregorian_to_jdn() in double precision lanes.  All of the
+    intermediate values are integers well below 2^53, so every operation is exact and the
+    results are bit-identical to the scalar functions.  The floored divisions multiply by
+    the reciprocal; the reciprocals of 400, 100, 5 and 4 all round upwards (or are exact),
+    so an exact multiple can never floor to the integer below.
+    Blocks holding a year outside [-2^31..2^31) or an invalid month fall back to the scalar code.
+
+    The decoding kernels run jdn_to_gregorian() the same way.  Their floored divisions use
+    floor((x + 0.5) / d), which is exact for integers far beyond the supported range and
+    lets every divisor use a plain reciprocal.  std::round() is reproduced exactly as
+    floor(x) + (x - floor(x) >= 0.5).  Blocks holding a JDN outside [-2^31..2^31) (or a NaN)
+    fall back to the scalar code.
+    */
+
+#include <khronos/batch.hpp>
+#include <algorithm>
+#include <cassert>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define KHRONOS_BATCH_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#define KHRONOS_TARGET_AVX2
+#define KHRONOS_TARGET_AVX512
+#else
+#define KHRONOS_TARGET_AVX2 __attribute__((target("avx2")))
+#define KHRONOS_TARGET_AVX512 __attribute__((target("avx2,avx512f")))
+#endif
+#endif
+
+
+namespace khronos::batch {
+
+    namespace {
+
+        // Scalar conversion of the elements [first..last).
+        void gregorian_to_jd_scalar(const year_t* years, const month_t* months, const day_t* days,
+            const hour_t* hours, const minute_t* minutes, const second_t* seconds,
+            jd_t* out, std::size_t first, std::size_t last) {
+            if (hours == nullptr) {
+                for (auto i = first; i < last; ++i)
+                    out[i] = khronos::gregorian_to_jd(years[i], months[i], days[i]);
+            }
+            else {
+                for (auto i = first; i < last; ++i)
+                    out[i] = khronos::gregorian_to_jd(years[i], months[i], days[i], hours[i], minutes[i], seconds[i]);
+            }
+        }
+
+        // Scalar decoding of the elements [first..last).
+        void jd_to_gregorian_scalar(const jd_t* jds, year_t* years, month_t* months, day_t* days,
+            hour_t* hours, minute_t* minutes, second_t* seconds, std::size_t first, std::size_t last) {
+            if (hours == nullptr) {
+                for (auto i = first; i < last; ++i)
+                    khronos::jd_to_gregorian(jds[i], years[i], months[i], days[i]);
+            }
+            else {
+                for (auto i = first; i < last; ++i)
+                    khronos::jd_to_gregorian(jds[i], years[i], months[i], days[i], hours[i], minutes[i], seconds[i]);
+            }
+        }
+
+#if defined(KHRONOS_BATCH_X86)
+
+        // Converts 4 elements per step, returns the number of elements converted.
+        KHRONOS_TARGET_AVX2
+        std::size_t gregorian_to_jd_avx2(const year_t* years, const month_t* months, const day_t* days,
+            const hour_t* hours, const minute_t* minutes, const second_t* seconds,
+            jd_t* out, std::size_t n) {
+            __m256i const yearBias = _mm256_set1_epi64x(0x8000'0000LL);
+            __m256i const lowDwords = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+            __m128i const one32 = _mm_set1_epi32(1);
+            __m128i const twelve32 = _mm_set1_epi32(12);
+
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m256i const y64 = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(years + i));
+                __m128i const m32 = _mm_loadu_si128(reinterpret_cast<__m128i const*>(months + i));
+
+                // out of the exact range: use the scalar code for this block.
+                __m256i const yHigh = _mm256_srli_epi64(_mm256_add_epi64(y64, yearBias), 32);
+                __m128i const mBad = _mm_or_si128(_mm_cmplt_epi32(m32, one32), _mm_cmpgt_epi32(m32, twelve32));
+                if (!_mm256_testz_si256(yHigh, yHigh) || !_mm_testz_si128(mBad, mBad)) {
+                    gregorian_to_jd_scalar(years, months, days, hours, minutes, seconds, out, i, i + 4);
+                    continue;
+                }
+
+                __m256d y = _mm256_cvtepi32_pd(_mm256_castsi256_si128(_mm256_permutevar8x32_epi32(y64, lowDwords)));
+                __m256d const m = _mm256_cvtepi32_pd(m32);
+                __m256d const d = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<__m128i const*>(days + i)));
+
+                // March-based year
+                __m256d const janFeb = _mm256_cmp_pd(m, _mm256_set1_pd(2.5), _CMP_LT_OQ);
+                y = _mm256_sub_pd(y, _mm256_and_pd(janFeb, _mm256_set1_pd(1.0)));
+                __m256d const mp = _mm256_add_pd(m, _mm256_blendv_pd(_mm256_set1_pd(-3.0), _mm256_set1_pd(9.0), janFeb));
+
+                __m256d const era = _mm256_floor_pd(_mm256_mul_pd(y, _mm256_set1_pd(1.0 / 400)));
+                __m256d const yoe = _mm256_sub_pd(y, _mm256_mul_pd(era, _mm256_set1_pd(400.0)));
+                __m256d const doy = _mm256_add_pd(
+                    _mm256_floor_pd(_mm256_mul_pd(_mm256_add_pd(_mm256_mul_pd(mp, _mm256_set1_pd(153.0)), _mm256_set1_pd(2.0)), _mm256_set1_pd(1.0 / 5))),
+                    _mm256_sub_pd(d, _mm256_set1_pd(1.0)));
+                __m256d const doe = _mm256_add_pd(
+                    _mm256_add_pd(_mm256_mul_pd(yoe, _mm256_set1_pd(365.0)), _mm256_floor_pd(_mm256_mul_pd(yoe, _mm256_set1_pd(1.0 / 4)))),
+                    _mm256_sub_pd(doy, _mm256_floor_pd(_mm256_mul_pd(yoe, _mm256_set1_pd(1.0 / 100)))));
+                __m256d const jdn = _mm256_add_pd(_mm256_mul_pd(era, _mm256_set1_pd(146'097.0)), _mm256_add_pd(doe, _mm256_set1_pd(1'721'120.0)));
+                __m256d jd = _mm256_sub_pd(jdn, _mm256_set1_pd(0.5));
+
+                if (hours != nullptr) {
+                    __m256d const h = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<__m128i const*>(hours + i)));
+                    __m256d const mi = _mm256_cvtepi32_pd(_mm_loadu_si128(reinterpret_cast<__m128i const*>(minutes + i)));
+                    __m256d const s = _mm256_loadu_pd(seconds + i);
+                    __m256d const secs = _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(h, _mm256_set1_pd(3600.0)), _mm256_mul_pd(mi, _mm256_set1_pd(60.0))), s);
+                    jd = _mm256_add_pd(jd, _mm256_div_pd(secs, _mm256_set1_pd(86400.0)));
+                }
+                _mm256_storeu_pd(out + i, jd);
+            }
+            return i;
+        }
+
+
+
+        // Converts 8 elements per step, returns the number of elements converted.
+        KHRONOS_TARGET_AVX512
+        std::size_t gregorian_to_jd_avx512(const year_t* years, const month_t* months, const day_t* days,
+            const hour_t* hours, const minute_t* minutes, const second_t* seconds,
+            jd_t* out, std::size_t n) {
+            constexpr int FLOOR = _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC;
+            __m512i const yearBias = _mm512_set1_epi64(0x8000'0000LL);
+
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m512i const y64 = _mm512_loadu_si512(years + i);
+                __m512d const m = _mm512_cvtepi32_pd(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(months + i)));
+
+                // out of the exact range: use the scalar code for this block.
+                __m512i const yHigh = _mm512_srli_epi64(_mm512_add_epi64(y64, yearBias), 32);
+                __mmask8 const mBad = _mm512_cmp_pd_mask(m, _mm512_set1_pd(1.0), _CMP_LT_OQ) | _mm512_cmp_pd_mask(m, _mm512_set1_pd(12.0), _CMP_GT_OQ);
+                if (_mm512_test_epi64_mask(yHigh, yHigh) != 0 || mBad != 0) {
+                    gregorian_to_jd_scalar(years, months, days, hours, minutes, seconds, out, i, i + 8);
+                    continue;
+                }
+
+                __m512d y = _mm512_cvtepi32_pd(_mm512_cvtepi64_epi32(y64));
+                __m512d const d = _mm512_cvtepi32_pd(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(days + i)));
+
+                // March-based year
+                __mmask8 const janFeb = _mm512_cmp_pd_mask(m, _mm512_set1_pd(2.5), _CMP_LT_OQ);
+                y = _mm512_mask_sub_pd(y, janFeb, y, _mm512_set1_pd(1.0));
+                __m512d const mp = _mm512_add_pd(m, _mm512_mask_blend_pd(janFeb, _mm512_set1_pd(-3.0), _mm512_set1_pd(9.0)));
+
+                __m512d const era = _mm512_roundscale_pd(_mm512_mul_pd(y, _mm512_set1_pd(1.0 / 400)), FLOOR);
+                __m512d const yoe = _mm512_sub_pd(y, _mm512_mul_pd(era, _mm512_set1_pd(400.0)));
+                __m512d const doy = _mm512_add_pd(
+                    _mm512_roundscale_pd(_mm512_mul_pd(_mm512_add_pd(_mm512_mul_pd(mp, _mm512_set1_pd(153.0)), _mm512_set1_pd(2.0)), _mm512_set1_pd(1.0 / 5)), FLOOR),
+                    _mm512_sub_pd(d, _mm512_set1_pd(1.0)));
+                __m512d const doe = _mm512_add_pd(
+                    _mm512_add_pd(_mm512_mul_pd(yoe, _mm512_set1_pd(365.0)), _mm512_roundscale_pd(_mm512_mul_pd(yoe, _mm512_set1_pd(1.0 / 4)), FLOOR)),
+                    _mm512_sub_pd(doy, _mm512_roundscale_pd(_mm512_mul_pd(yoe, _mm512_set1_pd(1.0 / 100)), FLOOR)));
+                __m512d const jdn = _mm512_add_pd(_mm512_mul_pd(era, _mm512_set1_pd(146'097.0)), _mm512_add_pd(doe, _mm512_set1_pd(1'721'120.0)));
+                __m512d jd = _mm512_sub_pd(jdn, _mm512_set1_pd(0.5));
+
+                if (hours != nullptr) {
+                    __m512d const h = _mm512_cvtepi32_pd(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(hours + i)));
+                    __m512d const mi = _mm512_cvtepi32_pd(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(minutes + i)));
+                    __m512d const s = _mm512_loadu_pd(seconds + i);
+                    __m512d const secs = _mm512_add_pd(_mm512_add_pd(_mm512_mul_pd(h, _mm512_set1_pd(3600.0)), _mm512_mul_pd(mi, _mm512_set1_pd(60.0))), s);
+                    jd = _mm512_add_pd(jd, _mm512_div_pd(secs, _mm512_set1_pd(86400.0)));
+                }
+                _mm512_storeu_pd(out + i, jd);
+            }
+            return i;
+        }
+
+
+
+
+        // Floored division of integer-valued lanes by the divisor whose reciprocal is 'inv'.
+        KHRONOS_TARGET_AVX2
+        inline __m256d floor_div_avx2(__m256d x, double inv) {
+            return _mm256_floor_pd(_mm256_mul_pd(_mm256_add_pd(x, _mm256_set1_pd(0.5)), _mm256_set1_pd(inv)));
+        }
+
+        // Stores 4 integer-valued lanes as 32-bit integers.
+        KHRONOS_TARGET_AVX2
+        inline void store_int32_avx2(int* dst, __m256d x) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), _mm256_cvttpd_epi32(x));
+        }
+
+        // Decodes 4 elements per step, returns the number of elements decoded.
+        KHRONOS_TARGET_AVX2
+        std::size_t jd_to_gregorian_avx2(const jd_t* jds, year_t* years, month_t* months, day_t* days,
+            hour_t* hours, minute_t* minutes, second_t* seconds, std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 4 <= n; i += 4) {
+                __m256d const t = _mm256_add_pd(_mm256_loadu_pd(jds + i), _mm256_set1_pd(0.5));
+                __m256d const jdn = _mm256_floor_pd(t);
+
+                // out of the exact range (or NaN): use the scalar code for this block.
+                __m256d const inRange = _mm256_and_pd(
+                    _mm256_cmp_pd(jdn, _mm256_set1_pd(-2'147'483'648.0), _CMP_GE_OQ),
+                    _mm256_cmp_pd(jdn, _mm256_set1_pd(2'147'483'648.0), _CMP_LT_OQ));
+                if (_mm256_movemask_pd(inRange) != 0xF) {
+                    jd_to_gregorian_scalar(jds, years, months, days, hours, minutes, seconds, i, i + 4);
+                    continue;
+                }
+
+                __m256d const z = _mm256_sub_pd(jdn, _mm256_set1_pd(1'721'120.0));
+                __m256d const era = floor_div_avx2(z, 1.0 / 146'097);
+                __m256d const doe = _mm256_sub_pd(z, _mm256_mul_pd(era, _mm256_set1_pd(146'097.0)));
+                __m256d const yoe = floor_div_avx2(
+                    _mm256_add_pd(_mm256_sub_pd(doe, floor_div_avx2(doe, 1.0 / 1'460)),
+                        _mm256_sub_pd(floor_div_avx2(doe, 1.0 / 36'524), floor_div_avx2(doe, 1.0 / 146'096))),
+                    1.0 / 365);
+                __m256d const doy = _mm256_sub_pd(doe, _mm256_add_pd(_mm256_mul_pd(yoe, _mm256_set1_pd(365.0)),
+                    _mm256_sub_pd(floor_div_avx2(yoe, 1.0 / 4), floor_div_avx2(yoe, 1.0 / 100))));
+                __m256d const mp = floor_div_avx2(_mm256_add_pd(_mm256_mul_pd(doy, _mm256_set1_pd(5.0)), _mm256_set1_pd(2.0)), 1.0 / 153);
+                __m256d const d = _mm256_add_pd(_mm256_sub_pd(doy,
+                    floor_div_avx2(_mm256_add_pd(_mm256_mul_pd(mp, _mm256_set1_pd(153.0)), _mm256_set1_pd(2.0)), 1.0 / 5)), _mm256_set1_pd(1.0));
+                __m256d const marchToDec = _mm256_cmp_pd(mp, _mm256_set1_pd(10.0), _CMP_LT_OQ);
+                __m256d const m = _mm256_add_pd(mp, _mm256_blendv_pd(_mm256_set1_pd(-9.0), _mm256_set1_pd(3.0), marchToDec));
+                __m256d const y = _mm256_add_pd(_mm256_add_pd(yoe, _mm256_mul_pd(era, _mm256_set1_pd(400.0))),
+                    _mm256_andnot_pd(marchToDec, _mm256_set1_pd(1.0)));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(years + i), _mm256_cvtepi32_epi64(_mm256_cvttpd_epi32(y)));
+                store_int32_avx2(months + i, m);
+                store_int32_avx2(days + i, d);
+
+                if (hours != nullptr) {
+                    __m256d const x = _mm256_mul_pd(_mm256_sub_pd(t, jdn), _mm256_set1_pd(86400.0));
+                    __m256d const xFloor = _mm256_floor_pd(x);
+                    __m256d const roundUp = _mm256_cmp_pd(_mm256_sub_pd(x, xFloor), _mm256_set1_pd(0.5), _CMP_GE_OQ);
+                    __m256d const ts = _mm256_min_pd(_mm256_add_pd(xFloor, _mm256_and_pd(roundUp, _mm256_set1_pd(1.0))), _mm256_set1_pd(86399.0));
+                    __m256d const h = floor_div_avx2(ts, 1.0 / 3600);
+                    __m256d const rem = _mm256_sub_pd(ts, _mm256_mul_pd(h, _mm256_set1_pd(3600.0)));
+                    __m256d const mi = floor_div_avx2(rem, 1.0 / 60);
+                    store_int32_avx2(hours + i, h);
+                    store_int32_avx2(minutes + i, mi);
+                    _mm256_storeu_pd(seconds + i, _mm256_sub_pd(rem, _mm256_mul_pd(mi, _mm256_set1_pd(60.0))));
+                }
+            }
+            return i;
+        }
+
+
+
+        // Floored division of integer-valued lanes by the divisor whose reciprocal is 'inv'.
+        KHRONOS_TARGET_AVX512
+        inline __m512d floor_div_avx512(__m512d x, double inv) {
+            return _mm512_roundscale_pd(_mm512_mul_pd(_mm512_add_pd(x, _mm512_set1_pd(0.5)), _mm512_set1_pd(inv)), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+        }
+
+        // Stores 8 integer-valued lanes as 32-bit integers.
+        KHRONOS_TARGET_AVX512
+        inline void store_int32_avx512(int* dst, __m512d x) {
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst), _mm512_cvttpd_epi32(x));
+        }
+
+        // Decodes 8 elements per step, returns the number of elements decoded.
+        KHRONOS_TARGET_AVX512
+        std::size_t jd_to_gregorian_avx512(const jd_t* jds, year_t* years, month_t* months, day_t* days,
+            hour_t* hours, minute_t* minutes, second_t* seconds, std::size_t n) {
+            std::size_t i = 0;
+            for (; i + 8 <= n; i += 8) {
+                __m512d const t = _mm512_add_pd(_mm512_loadu_pd(jds + i), _mm512_set1_pd(0.5));
+                __m512d const jdn = _mm512_roundscale_pd(t, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+
+                // out of the exact range (or NaN): use the scalar code for this block.
+                __mmask8 const inRange =
+                    _mm512_cmp_pd_mask(jdn, _mm512_set1_pd(-2'147'483'648.0), _CMP_GE_OQ) &
+                    _mm512_cmp_pd_mask(jdn, _mm512_set1_pd(2'147'483'648.0), _CMP_LT_OQ);
+                if (inRange != 0xFF) {
+                    jd_to_gregorian_scalar(jds, years, months, days, hours, minutes, seconds, i, i + 8);
+                    continue;
+                }
+
+                __m512d const z = _mm512_sub_pd(jdn, _mm512_set1_pd(1'721'120.0));
+                __m512d const era = floor_div_avx512(z, 1.0 / 146'097);
+                __m512d const doe = _mm512_sub_pd(z, _mm512_mul_pd(era, _mm512_set1_pd(146'097.0)));
+                __m512d const yoe = floor_div_avx512(
+                    _mm512_add_pd(_mm512_sub_pd(doe, floor_div_avx512(doe, 1.0 / 1'460)),
+                        _mm512_sub_pd(floor_div_avx512(doe, 1.0 / 36'524), floor_div_avx512(doe, 1.0 / 146'096))),
+                    1.0 / 365);
+                __m512d const doy = _mm512_sub_pd(doe, _mm512_add_pd(_mm512_mul_pd(yoe, _mm512_set1_pd(365.0)),
+                    _mm512_sub_pd(floor_div_avx512(yoe, 1.0 / 4), floor_div_avx512(yoe, 1.0 / 100))));
+                __m512d const mp = floor_div_avx512(_mm512_add_pd(_mm512_mul_pd(doy, _mm512_set1_pd(5.0)), _mm512_set1_pd(2.0)), 1.0 / 153);
+                __m512d const d = _mm512_add_pd(_mm512_sub_pd(doy,
+                    floor_div_avx512(_mm512_add_pd(_mm512_mul_pd(mp, _mm512_set1_pd(153.0)), _mm512_set1_pd(2.0)), 1.0 / 5)), _mm512_set1_pd(1.0));
+                __mmask8 const janFeb = _mm512_cmp_pd_mask(mp, _mm512_set1_pd(10.0), _CMP_GE_OQ);
+                __m512d const m = _mm512_add_pd(mp, _mm512_mask_blend_pd(janFeb, _mm512_set1_pd(3.0), _mm512_set1_pd(-9.0)));
+                __m512d const yMarch = _mm512_add_pd(yoe, _mm512_mul_pd(era, _mm512_set1_pd(400.0)));
+                __m512d const y = _mm512_mask_add_pd(yMarch, janFeb, yMarch, _mm512_set1_pd(1.0));
+
+                _mm512_storeu_si512(years + i, _mm512_cvtepi32_epi64(_mm512_cvttpd_epi32(y)));
+                store_int32_avx512(months + i, m);
+                store_int32_avx512(days + i, d);
+
+                if (hours != nullptr) {
+                    __m512d const x = _mm512_mul_pd(_mm512_sub_pd(t, jdn), _mm512_set1_pd(86400.0));
+                    __m512d const xFloor = _mm512_roundscale_pd(x, _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC);
+                    __mmask8 const roundUp = _mm512_cmp_pd_mask(_mm512_sub_pd(x, xFloor), _mm512_set1_pd(0.5), _CMP_GE_OQ);
+                    __m512d const ts = _mm512_min_pd(_mm512_mask_add_pd(xFloor, roundUp, xFloor, _mm512_set1_pd(1.0)), _mm512_set1_pd(86399.0));
+                    __m512d const h = floor_div_avx512(ts, 1.0 / 3600);
+                    __m512d const rem = _mm512_sub_pd(ts, _mm512_mul_pd(h, _mm512_set1_pd(3600.0)));
+                    __m512d const mi = floor_div_avx512(rem, 1.0 / 60);
+                    store_int32_avx512(hours + i, h);
+                    store_int32_avx512(minutes + i, mi);
+                    _mm512_storeu_pd(seconds + i, _mm512_sub_pd(rem, _mm512_mul_pd(mi, _mm512_set1_pd(60.0))));
+                }
+            }
+            return i;
+        }
+
+#endif
+
+        // Dispatches to the active kernel, finishing the tail with the scalar code.
+        void gregorian_to_jd_dispatch(const year_t* years, const month_t* months, const day_t* days,
+            const hour_t* hours, const minute_t* minutes, const second_t* seconds,
+            jd_t* out, std::size_t n) {
+            std::size_t done = 0;
+#if defined(KHRONOS_BATCH_X86)
+            switch (active_isa()) {
+            case Isa::avx512:
+                done = gregorian_to_jd_avx512(years, months, days, hours, minutes, seconds, out, n);
+                break;
+            case Isa::avx2:
+                done = gregorian_to_jd_avx2(years, months, days, hours, minutes, seconds, out, n);
+                break;
+            default:
+                break;
+            }
+#endif
+            gregorian_to_jd_scalar(years, months, days, hours, minutes, seconds, out, done, n);
+        }
+
+        // Dispatches to the active decoding kernel, finishing the tail with the scalar code.
+        void jd_to_gregorian_dispatch(const jd_t* jds, year_t* years, month_t* months, day_t* days,
+            hour_t* hours, minute_t* minutes, second_t* seconds, std::size_t n) {
+            std::size_t done = 0;
+#if defined(KHRONOS_BATCH_X86)
+            switch (active_isa()) {
+            case Isa::avx512:
+                done = jd_to_gregorian_avx512(jds, years, months, days, hours, minutes, seconds, n);
+                break;
+            case Isa::avx2:
+                done = jd_to_gregorian_avx2(jds, years, months, days, hours, minutes, seconds, n);
+                break;
+            default:
+                break;
+            }
+#endif
+            jd_to_gregorian_scalar(jds, years, months, days, hours, minutes, seconds, done, n);
+        }
+    }
+
+
+
+    // Converts columns of Gregorian dates to Julian Days.
+    void gregorian_to_jd(std::span<const year_t> years, std::span<const month_t> months, std::span<const day_t> days,
+        std::span<jd_t> out) {
+        assert(years.size() == out.size() && months.size() == out.size() && days.size() == out.size());
+        gregorian_to_jd_dispatch(years.data(), months.data(), days.data(), nullptr, nullptr, nullptr, out.data(), out.size());
+    }
+
+    // Converts columns of Gregorian dates and times of day to Julian Days.
+    void gregorian_to_jd(std::span<const year_t> years, std::span<const month_t> months, std::span<const day_t> days,
+        std::span<const hour_t> hours, std::span<const minute_t> minutes, std::span<const second_t> seconds,
+        std::span<jd_t> out) {
+        assert(years.size() == out.size() && months.size() == out.size() && days.size() == out.size());
+        assert(hours.size() == out.size() && minutes.size() == out.size() && seconds.size() == out.size());
+        gregorian_to_jd_dispatch(years.data(), months.data(), days.data(), hours.data(), minutes.data(), seconds.data(), out.data(), out.size());
+    }
+
+    // Decodes a column of Julian Days into columns of Gregorian dates.
+    void jd_to_gregorian(std::span<const jd_t> jds,
+        std::span<year_t> years, std::span<month_t> months, std::span<day_t> days) {
+        assert(years.size() == jds.size() && months.size() == jds.size() && days.size() == jds.size());
+        jd_to_gregorian_dispatch(jds.data(), years.data(), months.data(), days.data(), nullptr, nullptr, nullptr, jds.size());
+    }
+
+    // Decodes a column of Julian Days into columns of Gregorian dates and times of day.
+    void jd_to_gregorian(std::span<const jd_t> jds,
+        std::span<year_t> years, std::span<month_t> months, std::span<day_t> days,
+        std::span<hour_t> hours, std::span<minute_t> minutes, std::span<second_t> seconds) {
+        assert(years.size() == jds.size() && months.size() == jds.size() && days.size() == jds.size());
+        assert(hours.size() == jds.size() && minutes.size() == jds.size() && seconds.size() == jds.size());
+        jd_to_gregorian_dispatch(jds.data(), years.data(), months.data(), days.data(), hours.data(), minutes.data(), seconds.data(), jds.size());
+    }
+
+    // Adds the same number of days to a column of Gregorian dates.
+    void add_days(std::span<const year_t> years, std::span<const month_t> months, std::span<const day_t> days,
+        std::int64_t n,
+        std::span<year_t> outYears, std::span<month_t> outMonths, std::span<day_t> outDays) {
+        assert(years.size() == outYears.size() && months.size() == outYears.size() && days.size() == outYears.size());
+        assert(outMonths.size() == outYears.size() && outDays.size() == outYears.size());
+
+        // Blocks go through the vector kernels as Julian Days, which is exact while the offset and
+        // every year stay below 2^31; anything larger takes the integer kernels one date at a time.
+        constexpr std::size_t BLOCK = 256;
+        constexpr std::int64_t LIMIT = 0x8000'0000LL;
+        jd_t jds[BLOCK];
+        for (std::size_t first = 0; first < years.size(); first += BLOCK) {
+            std::size_t const count = std::min(BLOCK, years.size() - first);
+            bool exact = n > -LIMIT && n < LIMIT;
+            for (std::size_t i = first; exact && i < first + count; ++i)
+                exact = years[i] > -LIMIT && years[i] < LIMIT;
+
+            if (exact) {
+                gregorian_to_jd_dispatch(years.data() + first, months.data() + first, days.data() + first,
+                    nullptr, nullptr, nullptr, jds, count);
+                for (std::size_t i = 0; i < count; ++i)
+                    jds[i] += static_cast<jd_t>(n);
+                jd_to_gregorian_dispatch(jds, outYears.data() + first, outMonths.data() + first, outDays.data() + first,
+                    nullptr, nullptr, nullptr, count);
+            }
+            else {
+                for (std::size_t i = first; i < first + count; ++i) {
+                    Gregorian const shifted = khronos::add_days(Gregorian(years[i], months[i], days[i]), n);
+                    outYears[i] = shifted.year();
+                    outMonths[i] = shifted.month();
+                    outDays[i] = shifted.day();
+                }
+            }
+        }
+    }
+
+} // end-of-namespace khronos::batch
@@ -0,0 +1,57 @@
+/**	@file batch_hebrew.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Hebrew calendar batch conversion implementations.
+    */
+
+#include <khronos/batch.hpp>
+#include <cassert>
+#include <cmath>
+
+
+namespace khronos::batch {
+
+    namespace {
+        // Decodes the day holding jd, looking up a new year only when the day is outside info's year.
+        void decode(jd_t jd, HebrewYearInfo& info, year_t& year, month_t& month, day_t& day) {
+            jdn_t const a = static_cast<jdn_t>(std::floor(jd + 1.0));  // The day turns over at noon.
+            if (a < info.tishri1 || a >= info.tishri1 + info.length)
+                info = hebrew_year_info_for_jdn(a);
+
+            year = info.year;
+            info.month_day(static_cast<day_t>(a - info.tishri1), month, day);
+        }
+    }
+
+
+
+    // Decodes a column of Julian Days into columns of Hebrew dates.
+    void jd_to_hebrew(std::span<const jd_t> jds,
+        std::span<year_t> years, std::span<month_t> months, std::span<day_t> days) {
+        assert(years.size() == jds.size() && months.size() == jds.size() && days.size() == jds.size());
+        HebrewYearInfo info{};
+        for (std::size_t i = 0; i < jds.size(); ++i)
+            decode(jds[i], info, years[i], months[i], days[i]);
+    }
+
+    // Decodes a column of Julian Days into columns of Hebrew dates and times of day.
+    void jd_to_hebrew(std::span<const jd_t> jds,
+        std::span<year_t> years, std::span<month_t> months, std::span<day_t> days,
+        std::span<hour_t> hours, std::span<minute_t> minutes, std::span<second_t> seconds) {
+        assert(years.size() == jds.size() && months.size() == jds.size() && days.size() == jds.size());
+        assert(hours.size() == jds.size() && minutes.size() == jds.size() && seconds.size() == jds.size());
+        HebrewYearInfo info{};
+        for (std::size_t i = 0; i < jds.size(); ++i) {
+            decode(jds[i], info, years[i], months[i], days[i]);
+
+            // Time of day, as khronos::jd_to_hebrew().
+            double const tod = jds[i] + 0.5 - std::floor(jds[i] + 0.5);
+            int const totalSeconds = static_cast<int>(std::round(tod * SECONDS_PER_DAY));
+            hours[i] = totalSeconds / 3600;
+            minutes[i] = (totalSeconds % 3600) / 60;
+            seconds[i] = totalSeconds % 60;
+        }
+    }
+
+} // end-of-namespace khronos::batch
@@ -0,0 +1,81 @@
+/**	@file batch_islamic.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Islamic calendar batch arithmetic implementations.
+    Each tabular variant gets its own instantiation, so the leap pattern and the epoch are
+    constants in the loops.
+    */
+
+#include <khronos/batch.hpp>
+#include <cassert>
+
+
+namespace khronos::batch {
+
+    // Converts columns of Islamic dates to Julian Days.
+    template <class LeapPattern, class Epoch>
+        requires BatchIslamicVariant<LeapPattern, Epoch>
+    void islamic_to_jd(std::span<const year_t> years, std::span<const month_t> months, std::span<const day_t> days,
+        std::span<jd_t> jds) {
+        assert(years.size() == jds.size() && months.size() == jds.size() && days.size() == jds.size());
+        for (std::size_t i = 0; i < jds.size(); ++i)
+            jds[i] = khronos::islamic_to_jd<LeapPattern, Epoch>(years[i], months[i], days[i]);
+    }
+
+    // Decodes a column of Julian Days into Islamic dates.
+    template <class LeapPattern, class Epoch>
+        requires BatchIslamicVariant<LeapPattern, Epoch>
+    void jd_to_islamic(std::span<const jd_t> jds,
+        std::span<year_t> years, std::span<month_t> months, std::span<day_t> days) {
+        assert(years.size() == jds.size() && months.size() == jds.size() && days.size() == jds.size());
+        for (std::size_t i = 0; i < jds.size(); ++i)
+            khronos::jd_to_islamic<LeapPattern, Epoch>(jds[i], years[i], months[i], days[i]);
+    }
+
+    // Adds the same number of days to a column of Islamic dates.
+    template <class LeapPattern, class Epoch>
+        requires BatchIslamicVariant<LeapPattern, Epoch>
+    void islamic_add_days(std::span<const year_t> years, std::span<const month_t> months, std::span<const day_t> days,
+        std::int64_t n,
+        std::span<year_t> outYears, std::span<month_t> outMonths, std::span<day_t> outDays) {
+        assert(years.size() == outYears.size() && months.size() == outYears.size() && days.size() == outYears.size());
+        assert(outMonths.size() == outYears.size() && outDays.size() == outYears.size());
+        for (std::size_t i = 0; i < years.size(); ++i)
+            jdn_to_islamic<LeapPattern, Epoch>(islamic_to_jdn<LeapPattern, Epoch>(years[i], months[i], days[i]) + n, outYears[i], outMonths[i], outDays[i]);
+    }
+
+    // Adds the same number of months to a column of Islamic dates.
+    template <class LeapPattern, class Epoch>
+        requires BatchIslamicVariant<LeapPattern, Epoch>
+    void islamic_add_months(std::span<const year_t> years, std::span<const month_t> months, std::span<const day_t> days,
+        std::int64_t n,
+        std::span<year_t> outYears, std::span<month_t> outMonths, std::span<day_t> outDays) {
+        assert(years.size() == outYears.size() && months.size() == outYears.size() && days.size() == outYears.size());
+        assert(outMonths.size() == outYears.size() && outDays.size() == outYears.size());
+        for (std::size_t i = 0; i < years.size(); ++i) {
+            IslamicTabular<LeapPattern, Epoch> const shifted = add_months(IslamicTabular<LeapPattern, Epoch>(years[i], months[i], days[i]), n);
+            outYears[i] = shifted.year();
+            outMonths[i] = shifted.month();
+            outDays[i] = shifted.day();
+        }
+    }
+
+
+
+#define KHRONOS_INSTANTIATE_ISLAMIC_BATCH(LeapPattern, Epoch) \
+    template void islamic_to_jd<LeapPattern, Epoch>(std::span<const year_t>, std::span<const month_t>, std::span<const day_t>, std::span<jd_t>); \
+    template void jd_to_islamic<LeapPattern, Epoch>(std::span<const jd_t>, std::span<year_t>, std::span<month_t>, std::span<day_t>); \
+    template void islamic_add_days<LeapPattern, Epoch>(std::span<const year_t>, std::span<const month_t>, std::span<const day_t>, \
+        std::int64_t, std::span<year_t>, std::span<month_t>, std::span<day_t>); \
+    template void islamic_add_months<LeapPattern, Epoch>(std::span<const year_t>, std::span<const month_t>, std::span<const day_t>, \
+        std::int64_t, std::span<year_t>, std::span<month_t>, std::span<day_t>);
+
+    KHRONOS_INSTANTIATE_ISLAMIC_BATCH(IslamicLeap16, IslamicCivilEpoch)
+    KHRONOS_INSTANTIATE_ISLAMIC_BATCH(IslamicLeap16, IslamicAstronomicalEpoch)
+    KHRONOS_INSTANTIATE_ISLAMIC_BATCH(IslamicLeap15, IslamicCivilEpoch)
+    KHRONOS_INSTANTIATE_ISLAMIC_BATCH(IslamicLeap15, IslamicAstronomicalEpoch)
+
+#undef KHRONOS_INSTANTIATE_ISLAMIC_BATCH
+
+} // end-of-namespace khronos::batch
@@ -0,0 +1,154 @@
+/**	@file clock.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Wall-clock service implementation.
+    */
+
+#include <khronos/clock.hpp>
+#include <khronos/gregorian_calendar.hpp>
+#include <atomic>
+#include <ctime>
+#include <time.h>
+
+
+namespace khronos::clock {
+
+    namespace {
+        constexpr std::int64_t SECONDS_PER_DAY_64 = 86'400;
+
+        // Floor division by a positive divisor.
+        constexpr std::int64_t floor_div(std::int64_t a, std::int64_t b) {
+            return (a >= 0 ? a : a - b + 1) / b;
+        }
+
+        // The operating system's clock and time zone.
+        class SystemSource : public Source {
+        public:
+            Instant now() const override {
+                std::timespec ts;
+#if defined(_WIN32)
+                std::timespec_get(&ts, TIME_UTC);
+#else
+                clock_gettime(CLOCK_REALTIME, &ts);
+#endif
+                return Instant{ static_cast<std::int64_t>(ts.tv_sec), static_cast<std::int32_t>(ts.tv_nsec) };
+            }
+
+            std::int32_t utc_offset(std::int64_t seconds) const override {
+                std::time_t const t = static_cast<std::time_t>(seconds);
+                std::tm local;
+#if defined(_MSC_VER)
+                localtime_s(&local, &t);
+#else
+                localtime_r(&t, &local);
+#endif
+                std::int64_t const localSeconds =
+                    (gregorian_to_jdn(year_t(local.tm_year) + 1900, local.tm_mon + 1, local.tm_mday) - UNIX_EPOCH_JDN) * SECONDS_PER_DAY_64
+                    + local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec;
+                return static_cast<std::int32_t>(localSeconds - seconds);
+            }
+        };
+
+        SystemSource const systemSource;
+        std::atomic<Source const*> activeSource{ &systemSource };
+
+        // Incremented after every change of source.  Readers load it before the source, so a reader
+        // that sees the new source also sees the new generation.
+        std::atomic<std::uint64_t> sourceGeneration{ 0 };
+
+        // The UTC second, the source generation and the local offset, packed into one word:
+        // second << 26 | (generation mod 2^8) << 18 | (offset + 2^17).
+        // The offset field is never zero, so 0 marks an empty cache.  An offset cached from a
+        // previous source carries an older generation and is not reused.
+        constexpr int OFFSET_BITS = 18;
+        constexpr int GENERATION_BITS = 8;
+        constexpr int SECOND_SHIFT = OFFSET_BITS + GENERATION_BITS;
+        constexpr std::int64_t OFFSET_BIAS = std::int64_t(1) << (OFFSET_BITS - 1);
+        constexpr std::int64_t CACHEABLE_SECONDS = std::int64_t(1) << (63 - SECOND_SHIFT);
+        std::atomic<std::uint64_t> cachedOffset{ 0 };
+
+        // The active source and its generation, read consistently.
+        struct Binding {
+            Source const& source;
+            std::uint64_t generation;
+        };
+
+        Binding binding() {
+            std::uint64_t const generation = sourceGeneration.load(std::memory_order_acquire);
+            return { *activeSource.load(std::memory_order_acquire), generation };
+        }
+
+        // Returns the local offset of the given second, querying the source once per second.
+        std::int32_t offset_of(Binding const& binding, std::int64_t seconds) {
+            bool const cacheable = seconds > -CACHEABLE_SECONDS && seconds < CACHEABLE_SECONDS;
+            std::uint64_t const tag = static_cast<std::uint64_t>(seconds) << SECOND_SHIFT
+                | (binding.generation & ((1u << GENERATION_BITS) - 1)) << OFFSET_BITS;
+            if (cacheable) {
+                std::uint64_t const word = cachedOffset.load(std::memory_order_relaxed);
+                if (word != 0 && (word & ~std::uint64_t((1u << OFFSET_BITS) - 1)) == tag)
+                    return static_cast<std::int32_t>(static_cast<std::int64_t>(word & ((1u << OFFSET_BITS) - 1)) - OFFSET_BIAS);
+            }
+
+            std::int32_t const offset = binding.source.utc_offset(seconds);
+            if (cacheable && offset > -OFFSET_BIAS && offset < OFFSET_BIAS)
+                cachedOffset.store(tag | static_cast<std::uint64_t>(offset + OFFSET_BIAS), std::memory_order_relaxed);
+            return offset;
+        }
+
+        // Julian Day of an instant given as seconds since the Unix epoch.
+        jd_t to_jd(std::int64_t seconds, std::int32_t nanoseconds) {
+            std::int64_t const days = floor_div(seconds, SECONDS_PER_DAY_64);
+            std::int64_t const sod = seconds - days * SECONDS_PER_DAY_64;
+            return static_cast<jd_t>(days + UNIX_EPOCH_JDN) - 0.5 + (sod + nanoseconds * 1e-9) / SECONDS_PER_DAY_64;
+        }
+    }
+
+
+
+    // Returns the operating system's clock and time zone.
+    Source const& system_source() {
+        return systemSource;
+    }
+
+    // Selects the clock source; offsets cached from the previous source are discarded.
+    void set_source(Source const* source) {
+        activeSource.store(source ? source : &systemSource, std::memory_order_release);
+        sourceGeneration.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    // Returns the current UTC instant.
+    Instant now() {
+        return activeSource.load(std::memory_order_acquire)->now();
+    }
+
+    // Returns the current UTC time as a Julian Day.
+    jd_t utc_jd() {
+        Instant const t = now();
+        return to_jd(t.seconds, t.nanoseconds);
+    }
+
+    // Returns the current local time as a Julian Day.
+    jd_t local_jd() {
+        Binding const active = binding();
+        Instant const t = active.source.now();
+        return to_jd(t.seconds + offset_of(active, t.seconds), t.nanoseconds);
+    }
+
+    // Returns the current local civil date and time of day.
+    LocalTime local_time() {
+        Binding const active = binding();
+        Instant const t = active.source.now();
+        std::int64_t const local = t.seconds + offset_of(active, t.seconds);
+        std::int64_t const days = floor_div(local, SECONDS_PER_DAY_64);
+        int const sod = static_cast<int>(local - days * SECONDS_PER_DAY_64);
+
+        LocalTime lt;
+        jdn_to_gregorian(days + UNIX_EPOCH_JDN, lt.year, lt.month, lt.day);
+        lt.hour = sod / 3600;
+        lt.minute = sod / 60 % 60;
+        lt.second = sod % 60;
+        return lt;
+    }
+
+} // end-of-namespace khronos::clock
@@ -0,0 +1,145 @@
+/**	@file format.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Allocation-free date formatting implementation.
+    */
+
+#include <khronos/format.hpp>
+#include <charconv>
+#include <cstdlib>
+
+
+namespace khronos {
+
+    namespace {
+        // Appends characters to [p, last), dropping whatever does not fit.
+        class Sink {
+            char* p_;
+            char* last_;
+        public:
+            Sink(char* first, char* last) : p_(first), last_(last) {}
+
+            char* end() const { return p_; }
+
+            void put(char c) {
+                if (p_ != last_)
+                    *p_++ = c;
+            }
+
+            void put(char const* s) {
+                while (*s)
+                    put(*s++);
+            }
+
+            void put(char const* first, char const* last) {
+                while (first != last)
+                    put(*first++);
+            }
+
+            // Integer, zero-padded to 'width' characters (as setw/setfill('0') or %0*d).
+            template <class Int>
+            void put_int(Int value, int width = 0) {
+                char buffer[24];
+                char* const end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+                for (auto n = end - buffer; n < width; ++n)
+                    put('0');
+                put(buffer, end);
+            }
+
+            // Whole seconds rounded as printf's "%02.0f".
+            void put_rounded_seconds(second_t value) {
+                char buffer[400];
+                char* const end = std::to_chars(buffer, buffer + sizeof(buffer), value, std::chars_format::fixed, 0).ptr;
+                for (auto n = end - buffer; n < 2; ++n)
+                    put('0');
+                put(buffer, end);
+            }
+        };
+    }
+
+
+
+    // Formats as "JD <value>", the value in the stream's default (%g) notation.
+    char* format_to(char* first, char* last, Jd const& value) {
+        Sink out(first, last);
+        out.put("JD ");
+        char buffer[32];
+        char* const end = std::to_chars(buffer, buffer + sizeof(buffer), value.jd(), std::chars_format::general, 6).ptr;
+        out.put(buffer, end);
+        return out.end();
+    }
+
+    // Formats as "Weekday, Month d yyyy CE, h:mm:ss am".
+    char* format_to(char* first, char* last, Gregorian const& value) {
+        Sink out(first, last);
+        out.put(day_name(day_of_week(value)));
+        out.put(", ");
+        out.put(civil::month_name_long(value.month()));
+        out.put(' ');
+        out.put_int(value.day());
+        out.put(' ');
+        if (value.year() > 0) {
+            out.put_int(value.year());
+            out.put(" CE");
+        }
+        else {
+            out.put_int(std::abs(value.year() - 1));
+            out.put(" BCE");
+        }
+        out.put(", ");
+        out.put_int(value.hour() % 12 == 0 ? 12 : value.hour() % 12);
+        out.put(':');
+        out.put_int(value.minute(), 2);
+        out.put(':');
+        out.put_int(static_cast<int>(value.second()), 2);
+        out.put(value.hour() < 12 ? " am" : " pm");
+        return out.end();
+    }
+
+    // Formats as "Month d, yyyy".
+    char* format_to(char* first, char* last, Julian const& value) {
+        Sink out(first, last);
+        out.put(julian_month_name(value.month()));
+        out.put(' ');
+        out.put_int(value.day());
+        out.put(", ");
+        out.put_int(value.year());
+        return out.end();
+    }
+
+    // Formats as "Month d yyyy, h:mm:ss am" with rounded seconds.
+    char* format_to(char* first, char* last, Hebrew const& value) {
+        Sink out(first, last);
+        out.put(hebrew_month_name_c_str(value.month()));
+        out.put(' ');
+        out.put_int(static_cast<unsigned>(value.day()));
+        out.put(' ');
+        out.put_int(value.year());
+
+        bool const isAm = value.hour() < 12;
+        int h = value.hour();
+        if (!isAm) h -= 12;
+        if (h == 0) h = 12;
+        out.put(", ");
+        out.put_int(h);
+        out.put(':');
+        out.put_int(value.minute(), 2);
+        out.put(':');
+        out.put_rounded_seconds(value.second());
+        out.put(isAm ? " am" : " pm");
+        return out.end();
+    }
+
+    // Formats as "JDN <day number> + <nanoseconds> ns".
+    char* format_to(char* first, char* last, JdExact const& value) {
+        Sink out(first, last);
+        out.put("JDN ");
+        out.put_int(value.jdn());
+        out.put(" + ");
+        out.put_int(value.nanoseconds());
+        out.put(" ns");
+        return out.end();
+    }
+
+}  // end of namespace khronos
@@ -6,6 +6,7 @@
     */
 
 #include <khronos/gregorian_calendar.hpp>
+#include <khronos/format.hpp>
 #include <cmath>
 #include<ostream>
 
@@ -43,24 +44,8 @@ namespace khronos {
         }
     }
 
-    // Converts the given time components into a fractional day value.
-    double tod(hour_t hour, minute_t minute, second_t second) {
-        return (hour * 3600 + minute * 60 + second) / (24.0 * 60 * 60);
-    }
-
     // Default constructor for Gregorian date, initializes to the current local time.
-    Gregorian::Gregorian() {
-        time_t utcTime = time(NULL);  // Get the current UTC time.
-        struct tm tmLocal;
-        localtime_s(&tmLocal, &utcTime);  // Convert to local time.
-
-        year_ = year_t(tmLocal.tm_year) + 1900;
-        month_ = static_cast<Month>(tmLocal.tm_mon + 1);
-        day_ = day_t(tmLocal.tm_mday);
-        hour_ = hour_t(tmLocal.tm_hour);
-        minute_ = minute_t(tmLocal.tm_min);
-        second_ = second_t(tmLocal.tm_sec);
-    }
+    Gregorian::Gregorian() : Gregorian(WTIMEOFDAY) {}
 
     // Constructor to initialize Gregorian date from a Julian Day.
     Gregorian::Gregorian(Jd jd) {
@@ -82,35 +67,10 @@ namespace khronos {
         second_ = second;
     }
 
-    // Conversion operator from Gregorian to Julian Day.
-    Gregorian::operator Jd() const {
-        return Jd(gregorian_to_jd(year_, month_, day_, hour_, minute_, second_));
-    }
-
     // Converts the Gregorian date to a string in a readable format.
     std::string Gregorian::to_string() const {
-        std::ostringstream oss;
-
-        // Add day name, month name, and day of the month.
-        oss << day_name(day_of_week(*this)) << ", "
-            << month_name_long(month_) << " " << day() << " ";
-
-        // Add the year with "CE" or "BCE" based on its value.
-        if (year_ > 0) {
-            oss << year_ << " CE";
-        }
-        else {
-            oss << std::abs(year_ - 1) << " BCE";
-        }
-
-        // Format the hour in 12-hour format and add am/pm.
-        int display_hour = (hour_ % 12 == 0) ? 12 : hour_ % 12;
-        oss << ", " << display_hour << ":"
-            << std::setw(2) << std::setfill('0') << minute_ << ":"
-            << std::setw(2) << std::setfill('0') << static_cast<int>(second_)
-            << (hour_ < 12 ? " am" : " pm");
-
-        return oss.str();  // Return the formatted string.
+        char buffer[FORMAT_BUFFER_SIZE];
+        return std::string(buffer, format_to(buffer, buffer + FORMAT_BUFFER_SIZE, *this));
     }
 
 }  // end of namespace khronos
\ No newline at end of file
@@ -6,8 +6,9 @@
     */
 
 #include <khronos/hebrew_calendar.hpp>
-#include <sstream>
-#include <iomanip>
+#include <khronos/format.hpp>
+#include <atomic>
+#include <cstdint>
 
 namespace khronos {
 
@@ -16,72 +17,74 @@ namespace khronos {
         from_jd(hebrew_to_jd(5784, 7, 1));  // 7th month is Tishri.
     }
 
-    // Constructor to initialize Hebrew date with all components.
-    Hebrew::Hebrew(year_t year, month_t month, day_t day,
-        hour_t hour, minute_t minute, second_t second)
-        : year_(year), month_(month), day_(day),
-        hour_(hour), minute_(minute), second_(second) {}
+    namespace {
+        // Direct-mapped cache of year information.  Each slot is a sequence lock: readers
+        // never block (a torn or missing entry is simply recomputed) and a writer that finds
+        // the slot busy skips publishing.
+        constexpr std::size_t HEBREW_YEAR_CACHE_SIZE = 1024;
 
-    // Calculates the delay in days at the start of the Hebrew year.
-    double hebrew_delay_of_week(year_t year) {
-        double months = std::floor((235.0 * year - 234.0) / 19.0);  // Moon cycles.
-        int parts = 12084 + 13753 * static_cast<int>(months);  // Parts calculation.
-        double days = months * 29 + std::floor(parts / 25920.0);  // Total days.
+        struct HebrewYearSlot {
+            std::atomic<std::uint32_t>  sequence{ 0 };
+            std::atomic<year_t>         year{ 0 };
+            std::atomic<jdn_t>          tishri1{ 0 };
+            std::atomic<std::int32_t>   shape{ 0 };  // length | leap << 16; zero when empty
+        };
 
-        if ((3 * static_cast<int>(days + 1)) % 7 < 3)  // Adjust if required.
-            days += 1;
+        HebrewYearSlot hebrewYearCache_g[HEBREW_YEAR_CACHE_SIZE];
+    }
 
-        return days;
+    // Returns the year information, from the cache when present.
+    HebrewYearInfo detail::cached_hebrew_year_info(year_t year) {
+        HebrewYearSlot& slot = hebrewYearCache_g[static_cast<std::size_t>(year) % HEBREW_YEAR_CACHE_SIZE];
+
+        std::uint32_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if ((sequence & 1) == 0) {
+            year_t const cachedYear = slot.year.load(std::memory_order_relaxed);
+            jdn_t const tishri1 = slot.tishri1.load(std::memory_order_relaxed);
+            std::int32_t const shape = slot.shape.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (shape != 0 && cachedYear == year && slot.sequence.load(std::memory_order_relaxed) == sequence)
+                return { year, tishri1, static_cast<day_t>(shape & 0xFFFF), (shape >> 16) != 0 };
+        }
+
+        HebrewYearInfo const info = compute_hebrew_year_info(year);
+
+        // Publish unless another writer holds the slot.
+        if ((sequence & 1) == 0 && slot.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_relaxed)) {
+            std::atomic_thread_fence(std::memory_order_release);
+            slot.year.store(info.year, std::memory_order_relaxed);
+            slot.tishri1.store(info.tishri1, std::memory_order_relaxed);
+            slot.shape.store(info.length | (info.leap ? 1 << 16 : 0), std::memory_order_relaxed);
+            slot.sequence.store(sequence + 2, std::memory_order_release);
+        }
+        return info;
+    }
+
+    // Calculates the delay in days at the start of the Hebrew year.
+    double hebrew_delay_of_week(year_t year) {
+        return static_cast<double>(detail::delay_of_week(year));
     }
 
     // Determines the delay between adjacent Hebrew years.
     double hebrew_delay_adjacent_year(year_t year) {
-        double last = hebrew_delay_of_week(year - 1);
-        double present = hebrew_delay_of_week(year);
-        double next = hebrew_delay_of_week(year + 1);
-
-        if (next - present == 356) return 2.0;  // Long year adjustment.
-        if (present - last == 382) return 1.0;  // Short year adjustment.
-        return 0.0;
+        using namespace detail;
+        return static_cast<double>(delay_adjacent_year(delay_of_week(year - 1), delay_of_week(year), delay_of_week(year + 1)));
     }
 
     // Calculates the number of days in a given Hebrew year.
     double hebrew_days_in_year(year_t year) {
-        return hebrew_to_jd(year + 1, 7, 1) - hebrew_to_jd(year, 7, 1);  // From Tishri to Tishri.
+        return hebrew_year_info(year).length;  // From Tishri to Tishri.
     }
 
     // Determines the number of days in a given Hebrew month.
     day_t hebrew_days_in_month(year_t year, month_t month) {
-        const int days_in_year = static_cast<int>(hebrew_days_in_year(year));  // Total days in the year.
-
-        // Specific month rules for determining days.
-        if (month == 2 || month == 4 || month == 6 || month == 10 || month == 13) return 29;
-        if (month == 12 && !is_hebrew_leapyear(year)) return 29;
-        if (month == 8 && days_in_year % 10 != 5) return 29;
-        if (month == 9 && days_in_year % 10 == 3) return 29;
-        return 30;
+        return hebrew_year_info(year).days_in_month(month);
     }
 
     // Converts the Hebrew date to a string representation.
     std::string Hebrew::to_string() const {
-        std::ostringstream oss;
-        oss << hebrew_month_name(month_) << ' ' << (unsigned)day_ << ' ' << year_;
-
-        bool isAm = hour_ < 12;  // Determine if the time is AM or PM.
-        int h = (int)hour_;
-        if (!isAm) h -= 12;
-        if (h == 0) h = 12;  // Handle 12-hour formatting.
-
-        char buff[100];
-        sprintf_s(buff, 99, ", %d:%02d:%02.0f %s", h, minute_, second_, isAm ? "am" : "pm");
-        oss << buff;
-
-        return oss.str();  // Return the formatted string.
-    }
-
-    // Converts the Hebrew date to Julian Day (JDN).
-    double Hebrew::to_jd() const {
-        return hebrew_to_jd(year_, month_, day_, hour_, minute_, second_);
+        char buffer[FORMAT_BUFFER_SIZE];
+        return std::string(buffer, format_to(buffer, buffer + FORMAT_BUFFER_SIZE, *this));
     }
 
     // Initializes the Hebrew date from a given Julian Day (JDN).
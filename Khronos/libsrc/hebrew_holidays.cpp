@@ -0,0 +1,101 @@
+/**	@file hebrew_holidays.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Jewish holiday generator implementation.
+    The year table slides a window of four molad delays (years y-1 .. y+2), so a range of
+    n years costs n + 3 delay computations instead of four per hebrew_to_jd call.
+    */
+
+#include <khronos/hebrew_holidays.hpp>
+#include <khronos/workday.hpp>
+
+
+namespace khronos {
+
+    namespace {
+        // A holiday at a fixed date of its year.
+        struct HolidayRule {
+            HebrewHoliday   holiday;
+            month_t         month;          // Adar is Veadar in leap years
+            day_t           day;
+            bool            diasporaOnly;
+        };
+
+        constexpr HolidayRule HOLIDAY_RULES[] = {
+            { HebrewHoliday::rosh_hashanah, Tishri, 1, false },
+            { HebrewHoliday::rosh_hashanah_2, Tishri, 2, false },
+            { HebrewHoliday::fast_of_gedaliah, Tishri, 3, false },
+            { HebrewHoliday::yom_kippur, Tishri, 10, false },
+            { HebrewHoliday::sukkot, Tishri, 15, false },
+            { HebrewHoliday::sukkot_2, Tishri, 16, true },
+            { HebrewHoliday::hoshana_rabbah, Tishri, 21, false },
+            { HebrewHoliday::shemini_atzeret, Tishri, 22, false },
+            { HebrewHoliday::simchat_torah, Tishri, 23, false },
+            { HebrewHoliday::hanukkah, Kislev, 25, false },
+            { HebrewHoliday::tenth_of_tevet, Teveth, 10, false },
+            { HebrewHoliday::fast_of_esther, Adar, 13, false },
+            { HebrewHoliday::purim, Adar, 14, false },
+            { HebrewHoliday::shushan_purim, Adar, 15, false },
+            { HebrewHoliday::pesach, Nisan, 15, false },
+            { HebrewHoliday::pesach_2, Nisan, 16, true },
+            { HebrewHoliday::pesach_7, Nisan, 21, false },
+            { HebrewHoliday::pesach_8, Nisan, 22, true },
+            { HebrewHoliday::shavuot, Sivan, 6, false },
+            { HebrewHoliday::shavuot_2, Sivan, 7, true },
+            { HebrewHoliday::seventeenth_of_tammuz, Tammuz, 17, false },
+            { HebrewHoliday::tisha_bav, Av, 9, false },
+        };
+
+        // Day observed for a holiday nominally on jdn.
+        jdn_t observed(HebrewHoliday holiday, jdn_t jdn, HolidayRegion region) {
+            switch (holiday) {
+            case HebrewHoliday::fast_of_gedaliah:
+            case HebrewHoliday::seventeenth_of_tammuz:
+            case HebrewHoliday::tisha_bav:
+                return weekday_of_jdn(jdn) == Saturday ? jdn + 1 : jdn;
+            case HebrewHoliday::fast_of_esther:
+                return weekday_of_jdn(jdn) == Saturday ? jdn - 2 : jdn;
+            case HebrewHoliday::simchat_torah:
+                return region == HolidayRegion::israel ? jdn - 1 : jdn;
+            default:
+                return jdn;
+            }
+        }
+    }
+
+
+
+    // Appends the holidays of a range of Hebrew years.
+    void hebrew_holidays(year_t first_year, year_t last_year, HolidayRegion region, std::vector<HebrewHolidayDate>& out) {
+        if (last_year < first_year)
+            return;
+        out.reserve(out.size() + static_cast<std::size_t>(last_year - first_year + 1) * std::size(HOLIDAY_RULES));
+
+        long long d0 = detail::delay_of_week(first_year - 1);
+        long long d1 = detail::delay_of_week(first_year);
+        long long d2 = detail::delay_of_week(first_year + 1);
+        long long d3 = detail::delay_of_week(first_year + 2);
+        jdn_t tishri1 = detail::HEBREW_TISHRI1_BASE + d1 + detail::delay_adjacent_year(d0, d1, d2);
+
+        for (year_t year = first_year; year <= last_year; ++year) {
+            jdn_t const nextTishri1 = detail::HEBREW_TISHRI1_BASE + d2 + detail::delay_adjacent_year(d1, d2, d3);
+            HebrewYearInfo const info{ year, tishri1, static_cast<day_t>(nextTishri1 - tishri1), is_hebrew_leapyear(year) };
+
+            for (HolidayRule const& rule : HOLIDAY_RULES) {
+                if (rule.diasporaOnly && region == HolidayRegion::israel)
+                    continue;
+                month_t const month = rule.month == Adar && info.leap ? Veadar : rule.month;
+                jdn_t const jdn = observed(rule.holiday, info.jdn(month, rule.day), region);
+                out.push_back({ rule.holiday, year, Jd(static_cast<jd_t>(jdn) - 0.5) });
+            }
+
+            d0 = d1;
+            d1 = d2;
+            d2 = d3;
+            d3 = detail::delay_of_week(year + 3);
+            tishri1 = nextTishri1;
+        }
+    }
+
+} // end-of-namespace khronos
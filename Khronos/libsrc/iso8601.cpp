@@ -0,0 +1,270 @@
+/**	@file iso8601.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    ISO 8601 parser implementation.
+    The fixed-layout parts (YYYY-MM-, hh:mm:ss) are validated eight bytes at a time with
+    SWAR (SIMD within a register) compares before the fields are extracted.
+    */
+
+#include <khronos/iso8601.hpp>
+#include <khronos/gregorian_calendar.hpp>
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+
+namespace khronos {
+
+    namespace {
+        // Parsed fields; offset is the zone offset in minutes (local - UTC).
+        struct Fields {
+            year_t year = 0;
+            month_t month = 0;
+            day_t day = 0;
+            hour_t hour = 0;
+            minute_t minute = 0;
+            second_t second = 0;
+            int offset = 0;
+        };
+
+        // Byte masks for an eight character pattern: 'd' is any digit, '?' any byte, others literal.
+        struct SwarPattern {
+            std::uint64_t mask;
+            std::uint64_t expect;
+            std::uint64_t add;
+        };
+
+        constexpr SwarPattern swar_pattern(char const (&pattern)[9]) {
+            SwarPattern p{ 0, 0, 0 };
+            for (int i = 0; i < 8; ++i) {
+                int const shift = 8 * i;
+                if (pattern[i] == 'd') {
+                    p.mask |= std::uint64_t(0xF0) << shift;
+                    p.expect |= std::uint64_t(0x30) << shift;
+                    p.add |= std::uint64_t(0x06) << shift;
+                }
+                else if (pattern[i] != '?') {
+                    p.mask |= std::uint64_t(0xFF) << shift;
+                    p.expect |= std::uint64_t(static_cast<unsigned char>(pattern[i])) << shift;
+                }
+            }
+            return p;
+        }
+
+        constexpr SwarPattern DATE_PREFIX = swar_pattern("dddd-dd-");
+        constexpr SwarPattern TIME_HMS = swar_pattern("dd:dd:dd");
+
+        // True if the eight bytes at p match the pattern: a digit is 0x30..0x39, i.e. its high
+        // nibble is 3 both before and after adding 6.  Adding 6 to 0x30..0x3F never carries.
+        inline bool matches(char const* p, SwarPattern const& pattern) {
+            if constexpr (std::endian::native != std::endian::little)
+                return false;
+            std::uint64_t w;
+            std::memcpy(&w, p, 8);
+            return (w & pattern.mask) == pattern.expect && ((w + pattern.add) & pattern.mask) == pattern.expect;
+        }
+
+        constexpr bool is_digit(char c) { return c >= '0' && c <= '9'; }
+        constexpr int digit(char c) { return c - '0'; }
+        constexpr int two_digits(char const* p) { return digit(p[0]) * 10 + digit(p[1]); }
+
+        // Reads exactly two digits at p.
+        bool read_two(char const*& p, char const* end, int& value) {
+            if (end - p < 2 || !is_digit(p[0]) || !is_digit(p[1]))
+                return false;
+            value = two_digits(p);
+            p += 2;
+            return true;
+        }
+
+        // Reads the date part: [+|-]YYYY-MM-DD (a sign allows more than four year digits).
+        ParseError read_date(char const*& p, char const* end, Fields& f) {
+            if (end - p >= 10 && matches(p, DATE_PREFIX) && is_digit(p[8]) && is_digit(p[9])) {
+                f.year = two_digits(p) * 100 + two_digits(p + 2);
+                f.month = two_digits(p + 5);
+                f.day = two_digits(p + 8);
+                p += 10;
+                return ParseError::none;
+            }
+
+            bool negative = false;
+            bool const signed_ = p != end && (*p == '+' || *p == '-');
+            if (signed_)
+                negative = *p++ == '-';
+
+            char const* const first = p;
+            year_t year = 0;
+            while (p != end && is_digit(*p) && p - first < 18)
+                year = year * 10 + digit(*p++);
+            auto const count = p - first;
+            if (signed_ && p != end && is_digit(*p))
+                return ParseError::year_out_of_range;
+            if (count < 4 || (!signed_ && count != 4))
+                return ParseError::syntax;
+            f.year = negative ? -year : year;
+
+            if (p == end || *p++ != '-' || !read_two(p, end, f.month) || p == end || *p++ != '-' || !read_two(p, end, f.day))
+                return ParseError::syntax;
+            return ParseError::none;
+        }
+
+        // Reads the time part after the 'T': hh:mm[:ss[(.|,)f...]].
+        ParseError read_time(char const*& p, char const* end, Fields& f) {
+            if (end - p >= 8 && matches(p, TIME_HMS)) {
+                f.hour = two_digits(p);
+                f.minute = two_digits(p + 3);
+                f.second = two_digits(p + 6);
+                p += 8;
+            }
+            else {
+                if (!read_two(p, end, f.hour) || p == end || *p++ != ':' || !read_two(p, end, f.minute))
+                    return ParseError::syntax;
+                if (p != end && *p == ':') {
+                    int second;
+                    ++p;
+                    if (!read_two(p, end, second))
+                        return ParseError::syntax;
+                    f.second = second;
+                }
+                else
+                    return ParseError::none;
+            }
+
+            if (p != end && (*p == '.' || *p == ',')) {
+                constexpr double SCALE[10] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9 };
+                char const* const first = ++p;
+                std::int64_t fraction = 0;
+                int used = 0;
+                for (; p != end && is_digit(*p); ++p)
+                    if (used < 9) {
+                        fraction = fraction * 10 + digit(*p);
+                        ++used;
+                    }
+                if (p == first)
+                    return ParseError::syntax;
+                f.second += fraction / SCALE[used];
+            }
+            return ParseError::none;
+        }
+
+        // Reads an optional zone designator: Z | (+|-)hh[[:]mm].
+        ParseError read_zone(char const*& p, char const* end, Fields& f) {
+            if (p == end)
+                return ParseError::none;
+            if (*p == 'Z') {
+                ++p;
+                return ParseError::none;
+            }
+            if (*p != '+' && *p != '-')
+                return ParseError::syntax;
+            int const sign = *p++ == '-' ? -1 : 1;
+            int hours, minutes = 0;
+            if (!read_two(p, end, hours))
+                return ParseError::syntax;
+            if (p != end) {
+                if (*p == ':')
+                    ++p;
+                if (!read_two(p, end, minutes))
+                    return ParseError::syntax;
+            }
+            if (hours > 23 || minutes > 59)
+                return ParseError::invalid_time;
+            f.offset = sign * (hours * 60 + minutes);
+            return ParseError::none;
+        }
+
+        // Parses a complete record into its fields and validates them.
+        ParseError parse_fields(std::string_view text, Fields& f) {
+            char const* p = text.data();
+            char const* const end = p + text.size();
+
+            if (auto e = read_date(p, end, f); e != ParseError::none)
+                return e;
+            if (p != end) {
+                if (*p != 'T' && *p != ' ')
+                    return ParseError::syntax;
+                ++p;
+                if (auto e = read_time(p, end, f); e != ParseError::none)
+                    return e;
+                if (auto e = read_zone(p, end, f); e != ParseError::none)
+                    return e;
+                if (p != end)
+                    return ParseError::syntax;
+            }
+
+            if (f.year < GREGORIAN_JDN_MIN_YEAR || f.year > GREGORIAN_JDN_MAX_YEAR)
+                return ParseError::year_out_of_range;
+            if (f.month < 1 || f.month > 12 || f.day < 1 || f.day > civil::days_in_month(f.month, is_gregorian_leapyear(f.year)))
+                return ParseError::invalid_date;
+            if (f.hour > 23 || f.minute > 59 || !(f.second < 60))
+                return ParseError::invalid_time;
+            return ParseError::none;
+        }
+
+        // Calls fn(record) for each non-empty newline- or comma-delimited record.
+        template <class Fn>
+        void for_each_record(std::string_view text, Fn fn) {
+            std::size_t pos = 0;
+            while (pos < text.size()) {
+                std::size_t next = text.find_first_of(",\n", pos);
+                if (next == std::string_view::npos)
+                    next = text.size();
+                std::string_view record = text.substr(pos, next - pos);
+                if (!record.empty() && record.back() == '\r')
+                    record.remove_suffix(1);
+                if (!record.empty())
+                    fn(record);
+                pos = next + 1;
+            }
+        }
+    }
+
+
+
+    // Parses an ISO 8601 date or date-time into a Julian Day.
+    ParseResult parse_iso8601(std::string_view text) {
+        Fields f;
+        if (auto e = parse_fields(text, f); e != ParseError::none)
+            return e;
+        return Jd(gregorian_to_jd(f.year, f.month, f.day, f.hour, f.minute - f.offset, f.second));
+    }
+
+    // Parses delimited records into a column of Julian Days.
+    std::size_t parse_iso8601(std::string_view text, std::vector<jd_t>& out) {
+        std::size_t failures = 0;
+        for_each_record(text, [&](std::string_view record) {
+            Fields f;
+            if (parse_fields(record, f) == ParseError::none)
+                out.push_back(gregorian_to_jd(f.year, f.month, f.day, f.hour, f.minute - f.offset, f.second));
+            else {
+                out.push_back(std::numeric_limits<jd_t>::quiet_NaN());
+                ++failures;
+            }
+        });
+        return failures;
+    }
+
+    // Parses delimited records into date columns.
+    std::size_t parse_iso8601(std::string_view text,
+        std::vector<year_t>& years, std::vector<month_t>& months, std::vector<day_t>& days,
+        std::vector<hour_t>& hours, std::vector<minute_t>& minutes, std::vector<second_t>& seconds) {
+        std::size_t failures = 0;
+        for_each_record(text, [&](std::string_view record) {
+            Fields f;
+            if (parse_fields(record, f) != ParseError::none) {
+                f = Fields{};
+                ++failures;
+            }
+            years.push_back(f.year);
+            months.push_back(f.month);
+            days.push_back(f.day);
+            hours.push_back(f.hour);
+            minutes.push_back(f.minute - f.offset);
+            seconds.push_back(f.second);
+        });
+        return failures;
+    }
+
+} // end-of-namespace khronos
@@ -0,0 +1,50 @@
+/**	@file jd_exact.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Exact Julian Day class implementation.
+    */
+
+#include <khronos/jd_exact.hpp>
+#include <khronos/format.hpp>
+#include <cmath>
+#include <ostream>
+
+namespace khronos {
+
+    namespace {
+        // Splits a Julian Day into its civil day number and nanoseconds since midnight.
+        JdExact split(jd_t jd) {
+            double const jdn = std::floor(jd + 0.5);
+            double const fraction = jd + 0.5 - jdn;
+            return JdExact(static_cast<jdn_t>(jdn), std::llround(fraction * JdExact::NS_PER_DAY));
+        }
+    }
+
+    // Constructs from a Julian Day, to the nearest nanosecond.
+    JdExact::JdExact(Jd jd) : JdExact(split(jd.jd())) {}
+
+    // Converts to the nearest Julian Day.
+    jd_t JdExact::jd() const {
+        return (static_cast<jd_t>(jdn_) - 0.5) + static_cast<jd_t>(ns_) / NS_PER_DAY;
+    }
+
+    // Add (possibly fractional) days to an exact Julian Day.
+    JdExact operator + (JdExact const& jd, days const& d) {
+        double const whole = std::floor(d.value);
+        return add_nanoseconds(add_days(jd, static_cast<std::int64_t>(whole)),
+            std::llround((d.value - whole) * JdExact::NS_PER_DAY));
+    }
+
+    // Subtract (possibly fractional) days from an exact Julian Day.
+    JdExact operator - (JdExact const& jd, days const& d) {
+        return jd + days(-d.value);
+    }
+
+    // Overload of the << operator to print an exact Julian Day.
+    std::ostream& operator << (std::ostream& os, JdExact const& jd) {
+        char buffer[FORMAT_BUFFER_SIZE];
+        return os.write(buffer, format_to(buffer, buffer + FORMAT_BUFFER_SIZE, jd) - buffer);
+    }
+
+}  // end of namespace khronos
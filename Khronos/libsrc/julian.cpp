@@ -6,58 +6,25 @@
     */
 
 #include <khronos/julian_calendar.hpp>
+#include <khronos/convert.hpp>
+#include <khronos/format.hpp>
 
 namespace khronos {
 
     // Converts a Gregorian date to a Julian date.
     Julian julian_from_gregorian(const Gregorian& gregorian) {
-        // Convert Gregorian date to Julian Day (JDN).
-        jd_t jdn = gregorian_to_jd(
-            gregorian.year(), gregorian.month(), gregorian.day(),
-            gregorian.hour(), gregorian.minute(), gregorian.second()
-        );
-
-        // Convert JDN to Julian date components.
-        year_t year;
-        month_t month;
-        day_t day;
-        hour_t hour;
-        minute_t minute;
-        second_t second;
-
-        jd_to_julian(jdn, year, month, day, hour, minute, second);
-
-        // Return the corresponding Julian date.
-        return Julian(year, month, day, hour, minute, second);
+        return convert<Julian>(gregorian);
     }
 
     // Retrieves the current Gregorian date, optionally including time.
     Gregorian current_gregorian_date(bool include_time = true) {
-        std::time_t utcTime = std::time(nullptr);  // Get the current time.
-        std::tm tmLocal;
-        localtime_s(&tmLocal, &utcTime);  // Convert to local time.
-
-        if (include_time) {
-            // Return a Gregorian date with time.
-            return Gregorian(
-                year_t(tmLocal.tm_year) + 1900, month_t(tmLocal.tm_mon) + 1,
-                day_t(tmLocal.tm_mday), hour_t(tmLocal.tm_hour),
-                minute_t(tmLocal.tm_min), second_t(tmLocal.tm_sec)
-            );
-        }
-        else {
-            // Return a Gregorian date without time.
-            return Gregorian(
-                year_t(tmLocal.tm_year) + 1900, month_t(tmLocal.tm_mon) + 1,
-                day_t(tmLocal.tm_mday)
-            );
-        }
+        return Gregorian(include_time ? WTIMEOFDAY : NOTIMEOFDAY);
     }
 
     // Converts the Julian date to a string representation.
     std::string Julian::to_string() const {
-        return std::string(julian_month_name(month_)) + " " +
-            std::to_string(day_) + ", " + std::to_string(year_);
+        char buffer[FORMAT_BUFFER_SIZE];
+        return std::string(buffer, format_to(buffer, buffer + FORMAT_BUFFER_SIZE, *this));
     }
 
     // Default constructor for Julian, initializes to the current date.
@@ -0,0 +1,210 @@
+/**	@file recurrence.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Recurrence rule parser implementation.
+    */
+
+#include <khronos/recurrence.hpp>
+#include <khronos/gregorian_calendar.hpp>
+#include <cctype>
+#include <charconv>
+#include <string>
+
+
+namespace khronos {
+
+    namespace {
+        // Reads a whole signed decimal integer ('+' allowed).
+        bool read_int(std::string_view text, int& value) {
+            if (!text.empty() && text.front() == '+')
+                text.remove_prefix(1);
+            if (text.empty())
+                return false;
+            auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+            return ec == std::errc() && end == text.data() + text.size();
+        }
+
+        // Reads a two-letter weekday code (MO .. SU) as Monday = 0 .. Sunday = 6.
+        bool read_weekday(std::string_view text, int& weekday) {
+            static constexpr std::string_view codes[] = { "MO", "TU", "WE", "TH", "FR", "SA", "SU" };
+            for (int d = 0; d < 7; ++d)
+                if (text == codes[d]) {
+                    weekday = d;
+                    return true;
+                }
+            return false;
+        }
+
+        // Calls fn(item) for each comma-separated item; stops at the first false.
+        template <class Fn>
+        bool for_each_item(std::string_view list, Fn fn) {
+            for (;;) {
+                std::size_t const comma = list.find(',');
+                if (!fn(list.substr(0, comma)))
+                    return false;
+                if (comma == std::string_view::npos)
+                    return true;
+                list.remove_prefix(comma + 1);
+            }
+        }
+
+        // Reads a list of integers in [-limit..-1] or [1..limit] (negatives only when allowed).
+        bool read_int_list(std::string_view list, int limit, bool negative, std::vector<int>& out) {
+            return for_each_item(list, [&](std::string_view item) {
+                int value;
+                if (!read_int(item, value) || value == 0 || value > limit || value < (negative ? -limit : 1))
+                    return false;
+                out.push_back(value);
+                return true;
+            });
+        }
+
+        // Reads UNTIL: YYYYMMDD, optionally followed by Thhmmss[Z].
+        bool read_until(std::string_view text, jdn_t& until) {
+            if (text.size() != 8 && text.size() != 15 && text.size() != 16)
+                return false;
+            for (std::size_t i = 0; i < text.size(); ++i) {
+                bool const ok = i == 8 ? text[i] == 'T' : i == 15 ? text[i] == 'Z' : std::isdigit(static_cast<unsigned char>(text[i])) != 0;
+                if (!ok)
+                    return false;
+            }
+            int year, month, day;
+            read_int(text.substr(0, 4), year);
+            read_int(text.substr(4, 2), month);
+            read_int(text.substr(6, 2), day);
+            if (month < 1 || month > 12 || day < 1 || day > gregorian_days_in_month(month, is_gregorian_leapyear(year)))
+                return false;
+            until = gregorian_to_jdn(year, month, day);
+            return true;
+        }
+    }
+
+
+
+    // Compiles an RFC 5545 recurrence rule.
+    ParseError parse_rrule(std::string_view text, RecurrenceRule& rule) {
+        using Frequency = RecurrenceRule::Frequency;
+        rule = RecurrenceRule{};
+
+        std::string upper(text);
+        for (char& c : upper)
+            c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+        std::string_view rest(upper);
+        if (rest.starts_with("RRULE:"))
+            rest.remove_prefix(6);
+
+        unsigned seen = 0;      // bit per part name, to reject repeats
+        bool invalid = false;   // well-formed but unsupported or out of range
+        while (!rest.empty()) {
+            std::size_t const semicolon = rest.find(';');
+            std::string_view const part = rest.substr(0, semicolon);
+            rest.remove_prefix(semicolon == std::string_view::npos ? rest.size() : semicolon + 1);
+
+            std::size_t const equals = part.find('=');
+            if (equals == std::string_view::npos)
+                return ParseError::syntax;
+            std::string_view const name = part.substr(0, equals);
+            std::string_view const value = part.substr(equals + 1);
+            if (value.empty())
+                return ParseError::syntax;
+
+            static constexpr std::string_view names[] = {
+                "FREQ", "INTERVAL", "COUNT", "UNTIL", "WKST", "BYMONTH", "BYMONTHDAY", "BYDAY", "BYSETPOS", "SKIP", "RSCALE",
+                "BYSECOND", "BYMINUTE", "BYHOUR", "BYYEARDAY", "BYWEEKNO" };
+            unsigned index = 0;
+            while (index < std::size(names) && names[index] != name)
+                ++index;
+            if (index == std::size(names) || seen >> index & 1)
+                return ParseError::syntax;
+            seen |= 1u << index;
+
+            switch (index) {
+            case 0:
+                if (value == "DAILY") rule.frequency = Frequency::daily;
+                else if (value == "WEEKLY") rule.frequency = Frequency::weekly;
+                else if (value == "MONTHLY") rule.frequency = Frequency::monthly;
+                else if (value == "YEARLY") rule.frequency = Frequency::yearly;
+                else if (value == "SECONDLY" || value == "MINUTELY" || value == "HOURLY") invalid = true;
+                else return ParseError::syntax;
+                break;
+            case 1:
+                if (!read_int(value, rule.interval))
+                    return ParseError::syntax;
+                invalid |= rule.interval < 1;
+                break;
+            case 2: {
+                int count;
+                if (!read_int(value, count))
+                    return ParseError::syntax;
+                invalid |= count < 1;
+                rule.count = count;
+                break;
+            }
+            case 3:
+                if (!read_until(value, rule.until))
+                    return ParseError::syntax;
+                break;
+            case 4:
+                if (!read_weekday(value, rule.weekStart))
+                    return ParseError::syntax;
+                break;
+            case 5: {
+                std::vector<int> months;
+                if (!read_int_list(value, 13, false, months))
+                    return ParseError::syntax;
+                for (int month : months)
+                    rule.byMonth |= static_cast<std::uint16_t>(1u << month);
+                break;
+            }
+            case 6:
+                if (!read_int_list(value, 31, true, rule.byMonthDay))
+                    return ParseError::syntax;
+                break;
+            case 7:
+                if (!for_each_item(value, [&](std::string_view item) {
+                    RecurrenceRule::WeekdayNum entry{ 0, 0 };
+                    if (item.size() < 2 || !read_weekday(item.substr(item.size() - 2), entry.weekday))
+                        return false;
+                    item.remove_suffix(2);
+                    if (!item.empty() && (!read_int(item, entry.ordinal) || entry.ordinal == 0 || entry.ordinal < -53 || entry.ordinal > 53))
+                        return false;
+                    rule.byDay.push_back(entry);
+                    return true;
+                }))
+                    return ParseError::syntax;
+                break;
+            case 8:
+                if (!read_int_list(value, 366, true, rule.bySetPos))
+                    return ParseError::syntax;
+                break;
+            case 9:
+                if (value == "OMIT") rule.skip = RecurrenceRule::Skip::omit;
+                else if (value == "BACKWARD") rule.skip = RecurrenceRule::Skip::backward;
+                else if (value == "FORWARD") rule.skip = RecurrenceRule::Skip::forward;
+                else return ParseError::syntax;
+                break;
+            case 10:
+                break;
+            default:
+                invalid = true;
+                break;
+            }
+        }
+
+        if (!(seen & 1))
+            return ParseError::syntax;
+
+        // Combinations RFC 5545 forbids.
+        bool const ordinals = std::any_of(rule.byDay.begin(), rule.byDay.end(),
+            [](RecurrenceRule::WeekdayNum const& entry) { return entry.ordinal != 0; });
+        if (invalid
+            || (seen >> 2 & 1 && seen >> 3 & 1)
+            || (rule.frequency == Frequency::weekly && !rule.byMonthDay.empty())
+            || (ordinals && rule.frequency != Frequency::monthly && rule.frequency != Frequency::yearly)
+            || (!rule.bySetPos.empty() && rule.byMonth == 0 && rule.byMonthDay.empty() && rule.byDay.empty()))
+            return ParseError::invalid_rule;
+        return ParseError::none;
+    }
+
+} // end-of-namespace khronos
@@ -0,0 +1,204 @@
+/**	@file ummalqura.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Umm al-Qura calendar implementation: table selection and table files.
+    */
+
+#include <khronos/ummalqura_calendar.hpp>
+#include <khronos/clock.hpp>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <utility>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace khronos {
+
+    namespace {
+        std::atomic<UmmAlQuraTable const*> activeTable{ &UMMALQURA_TABLE };
+
+        // Layout of a table file.
+        constexpr char FILE_MAGIC[4] = { 'K', 'U', 'Q', 'T' };
+        constexpr std::uint32_t FILE_VERSION = 1;
+
+        struct FileHeader {
+            char            magic[4];
+            std::uint32_t   version;
+            std::int32_t    firstYear;
+            std::int32_t    yearCount;
+        };
+        static_assert(sizeof(FileHeader) == 16);
+
+        // Bytes of the zero-padded anchor section of a table with the given number of blocks.
+        constexpr std::size_t anchor_bytes(std::size_t blocks) {
+            return (blocks * sizeof(std::int32_t) + 7) / 8 * 8;
+        }
+
+        // Maps a whole file read-only; returns nullptr on failure.
+        void const* map_file(std::string const& path, std::size_t& size) {
+#if defined(_WIN32)
+            HANDLE const file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+                return nullptr;
+            LARGE_INTEGER length;
+            void const* view = nullptr;
+            if (GetFileSizeEx(file, &length) && length.QuadPart > 0) {
+                HANDLE const mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+                if (mapping != nullptr) {
+                    view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+                    CloseHandle(mapping);   // the view keeps the mapping alive
+                }
+                size = static_cast<std::size_t>(length.QuadPart);
+            }
+            CloseHandle(file);
+            return view;
+#else
+            int const fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+                return nullptr;
+            struct stat info;
+            void* view = nullptr;
+            if (fstat(fd, &info) == 0 && info.st_size > 0) {
+                view = mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+                if (view == MAP_FAILED)
+                    view = nullptr;
+                size = static_cast<std::size_t>(info.st_size);
+            }
+            ::close(fd);                    // the mapping outlives the descriptor
+            return view;
+#endif
+        }
+
+        void unmap_file(void const* view, std::size_t size) {
+#if defined(_WIN32)
+            (void)size;
+            UnmapViewOfFile(view);
+#else
+            munmap(const_cast<void*>(view), size);
+#endif
+        }
+    }
+
+
+
+    // Returns the selected table.
+    UmmAlQuraTable const& ummalqura_table() {
+        return *activeTable.load(std::memory_order_acquire);
+    }
+
+    // Selects the table used by UmmAlQura.
+    UmmAlQuraTable const* set_ummalqura_table(UmmAlQuraTable const* table) {
+        return activeTable.exchange(table ? table : &UMMALQURA_TABLE, std::memory_order_acq_rel);
+    }
+
+
+
+    // Default constructor: the current local time.
+    UmmAlQura::UmmAlQura() : UmmAlQura(WTIMEOFDAY) {}
+
+    // Constructor with current time option.
+    UmmAlQura::UmmAlQura(now_t option) {
+        clock::LocalTime const now = clock::local_time();
+        if (option == WTIMEOFDAY)
+            jd_to_ummalqura(gregorian_to_jd(now.year, now.month, now.day, now.hour, now.minute, now.second), year_, month_, day_, hour_, minute_, second_);
+        else
+            jd_to_ummalqura(gregorian_to_jd(now.year, now.month, now.day), year_, month_, day_);
+    }
+
+
+
+    // Maps a table file.
+    UmmAlQuraTableFile::UmmAlQuraTableFile(std::string const& path) {
+        view_ = map_file(path, size_);
+        if (!view_)
+            return;
+
+        auto const* bytes = static_cast<unsigned char const*>(view_);
+        FileHeader header;
+        if (size_ >= sizeof header)
+            std::memcpy(&header, bytes, sizeof header);
+        bool ok = size_ >= sizeof header
+            && std::memcmp(header.magic, FILE_MAGIC, sizeof FILE_MAGIC) == 0
+            && header.version == FILE_VERSION
+            && header.yearCount > 0;
+        if (ok) {
+            std::size_t const blocks = static_cast<std::size_t>((header.yearCount + UmmAlQuraTable::YEARS_PER_BLOCK - 1) / UmmAlQuraTable::YEARS_PER_BLOCK);
+            std::size_t const monthBytes = blocks * UmmAlQuraTable::WORDS_PER_BLOCK * sizeof(std::uint64_t);
+            ok = size_ == sizeof header + anchor_bytes(blocks) + monthBytes;
+            if (ok) {
+                table_ = UmmAlQuraTable(header.firstYear, header.yearCount,
+                    { reinterpret_cast<std::int32_t const*>(bytes + sizeof header), blocks },
+                    { reinterpret_cast<std::uint64_t const*>(bytes + sizeof header + anchor_bytes(blocks)), blocks * UmmAlQuraTable::WORDS_PER_BLOCK });
+                ok = table_.valid();
+            }
+        }
+        if (!ok)
+            close();
+    }
+
+    UmmAlQuraTableFile::~UmmAlQuraTableFile() {
+        close();
+    }
+
+    UmmAlQuraTableFile::UmmAlQuraTableFile(UmmAlQuraTableFile&& other) noexcept
+        : view_(std::exchange(other.view_, nullptr)), size_(std::exchange(other.size_, 0)), table_(std::exchange(other.table_, {})) {}
+
+    UmmAlQuraTableFile& UmmAlQuraTableFile::operator=(UmmAlQuraTableFile&& other) noexcept {
+        if (this != &other) {
+            close();
+            view_ = std::exchange(other.view_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+            table_ = std::exchange(other.table_, {});
+        }
+        return *this;
+    }
+
+    // Unmaps the file.
+    void UmmAlQuraTableFile::close() {
+        if (view_)
+            unmap_file(view_, size_);
+        view_ = nullptr;
+        size_ = 0;
+        table_ = {};
+    }
+
+
+
+    // Writes a table file.
+    bool write_ummalqura_table(std::string const& path, UmmAlQuraTable const& table) {
+        if (!table.valid())
+            return false;
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+
+        FileHeader header{};
+        std::memcpy(header.magic, FILE_MAGIC, sizeof FILE_MAGIC);
+        header.version = FILE_VERSION;
+        header.firstYear = static_cast<std::int32_t>(table.first_year());
+        header.yearCount = static_cast<std::int32_t>(table.last_year() - table.first_year() + 1);
+        out.write(reinterpret_cast<char const*>(&header), sizeof header);
+
+        std::span<std::int32_t const> const anchors = table.anchors();
+        out.write(reinterpret_cast<char const*>(anchors.data()), static_cast<std::streamsize>(anchors.size_bytes()));
+        char const padding[8] = {};
+        out.write(padding, static_cast<std::streamsize>(anchor_bytes(anchors.size()) - anchors.size_bytes()));
+
+        std::span<std::uint64_t const> const months = table.months();
+        out.write(reinterpret_cast<char const*>(months.data()), static_cast<std::streamsize>(months.size_bytes()));
+        return static_cast<bool>(out.flush());
+    }
+
+} // end-of-namespace khronos
@@ -0,0 +1,155 @@
+/**	@file workday.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    Business-day calendar implementation.
+    rank(x) is the number of business days in [first_, x) (negative before first_), and
+    select(k) the business day whose rank is k; every query is a difference of ranks or a
+    select of a shifted rank.
+    */
+
+#include <khronos/workday.hpp>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+
+
+namespace khronos {
+
+    // Builds the weekly tables and the business-day bitmap of the holiday span.
+    WorkdayCalendar::WorkdayCalendar(WeekendMask weekend, std::span<Jd const> holidays)
+        : weekend_(weekend & 0x7F), workdaysPerWeek_(7 - std::popcount(static_cast<unsigned>(weekend & 0x7F)))
+    {
+        assert(workdaysPerWeek_ > 0);
+
+        for (int d = 0; d < 7; ++d) {
+            int count = 0;
+            for (int n = 0; n < 7; ++n) {
+                workdaysIn_[d][n] = static_cast<std::int8_t>(count);
+                if (!(weekend_ >> (d + n) % 7 & 1))
+                    nthWorkday_[d][count++] = static_cast<std::int8_t>(n);
+            }
+            workdaysIn_[d][7] = static_cast<std::int8_t>(count);
+        }
+
+        // Holidays that fall on working weekdays, in order.
+        std::vector<jdn_t> days;
+        for (Jd const& holiday : holidays) {
+            jdn_t const jdn = to_jdn(holiday);
+            if (!(weekend_ >> weekday_of_jdn(jdn) & 1))
+                days.push_back(jdn);
+        }
+        std::sort(days.begin(), days.end());
+        days.erase(std::unique(days.begin(), days.end()), days.end());
+
+        if (days.empty()) {
+            rank_.push_back(0);
+            return;
+        }
+
+        first_ = days.front();
+        last_ = days.back() + 1;
+        std::size_t const words = static_cast<std::size_t>((last_ - first_ + 63) / 64);
+        bits_.assign(words, 0);
+        auto holiday = days.begin();
+        for (jdn_t jdn = first_; jdn < last_; ++jdn) {
+            if (holiday != days.end() && *holiday == jdn)
+                ++holiday;
+            else if (!(weekend_ >> weekday_of_jdn(jdn) & 1)) {
+                std::size_t const i = static_cast<std::size_t>(jdn - first_);
+                bits_[i / 64] |= std::uint64_t(1) << i % 64;
+            }
+        }
+
+        rank_.resize(words + 1);
+        rank_[0] = 0;
+        for (std::size_t w = 0; w < words; ++w) {
+            rank_[w + 1] = rank_[w] + std::popcount(bits_[w]);
+            for (std::int64_t k = static_cast<std::int64_t>(select_.size()) * SELECT_SAMPLE; k < rank_[w + 1]; k += SELECT_SAMPLE)
+                select_.push_back(static_cast<std::uint32_t>(w));
+        }
+    }
+
+
+
+    // True if the day is a business day.
+    bool WorkdayCalendar::is_workday_jdn(jdn_t jdn) const {
+        if (jdn >= first_ && jdn < last_) {
+            std::size_t const i = static_cast<std::size_t>(jdn - first_);
+            return bits_[i / 64] >> i % 64 & 1;
+        }
+        return !(weekend_ >> weekday_of_jdn(jdn) & 1);
+    }
+
+    // Number of days in [from, to) that are not weekend days (holidays ignored).
+    std::int64_t WorkdayCalendar::weekdays(jdn_t from, jdn_t to) const {
+        if (from > to)
+            return -weekdays(to, from);
+        std::int64_t const n = to - from;
+        return n / 7 * workdaysPerWeek_ + workdaysIn_[weekday_of_jdn(from)][n % 7];
+    }
+
+    // The k-th non-weekend day on or after from (k >= 0), or the -k-th before it (k < 0); holidays ignored.
+    jdn_t WorkdayCalendar::nth_weekday(jdn_t from, std::int64_t k) const {
+        std::int64_t weeks = k / workdaysPerWeek_;
+        std::int64_t rest = k % workdaysPerWeek_;
+        if (rest < 0) {
+            rest += workdaysPerWeek_;
+            --weeks;
+        }
+        return from + 7 * weeks + nthWorkday_[weekday_of_jdn(from)][rest];
+    }
+
+    // Business days in [first_, jdn); negative before first_.
+    std::int64_t WorkdayCalendar::rank(jdn_t jdn) const {
+        if (jdn <= first_)
+            return -weekdays(jdn, first_);
+        if (jdn >= last_)
+            return rank_.back() + weekdays(last_, jdn);
+        std::size_t const i = static_cast<std::size_t>(jdn - first_);
+        std::uint64_t const below = (std::uint64_t(1) << i % 64) - 1;
+        return rank_[i / 64] + std::popcount(bits_[i / 64] & below);
+    }
+
+    // The business day of rank k.
+    jdn_t WorkdayCalendar::select(std::int64_t k) const {
+        if (k < 0)
+            return nth_weekday(first_, k);
+        if (k >= rank_.back())
+            return nth_weekday(last_, k - rank_.back());
+
+        std::size_t w = select_[static_cast<std::size_t>(k / SELECT_SAMPLE)];
+        while (rank_[w + 1] <= k)
+            ++w;
+        std::uint64_t bits = bits_[w];
+        for (std::int64_t skip = k - rank_[w]; skip > 0; --skip)
+            bits &= bits - 1;
+        return first_ + static_cast<jdn_t>(w * 64) + std::countr_zero(bits);
+    }
+
+
+
+    // Moves a date by n business days, keeping its time of day.
+    Jd WorkdayCalendar::add(Jd date, std::int64_t n) const {
+        if (n == 0)
+            return date;
+        jdn_t const day = to_jdn(date);
+        jdn_t const result = select(n > 0 ? rank(day + 1) + n - 1 : rank(day) + n);
+        return Jd(date.jd() + static_cast<jd_t>(result - day));
+    }
+
+    // Counts business days for columns of intervals.
+    void WorkdayCalendar::count(std::span<Jd const> first, std::span<Jd const> last, std::span<std::int64_t> out) const {
+        assert(first.size() == out.size() && last.size() == out.size());
+        for (std::size_t i = 0; i < out.size(); ++i)
+            out[i] = count(first[i], last[i]);
+    }
+
+    // Moves columns of dates by business days.
+    void WorkdayCalendar::add(std::span<Jd const> dates, std::span<std::int64_t const> n, std::span<Jd> out) const {
+        assert(dates.size() == out.size() && n.size() == out.size());
+        for (std::size_t i = 0; i < out.size(); ++i)
+            out[i] = add(dates[i], n[i]);
+    }
+
+} // end-of-namespace khronos
@@ -126,7 +126,7 @@
 
 #define PHASE_90 true
 #define PHASE_91 true
-#define PHASE_92 false
+#define PHASE_92 true
 #define PHASE_93 false
 #define PHASE_94 false
 #define PHASE_95 false
@@ -157,12 +157,111 @@
 #define PHASE_118 false
 #define PHASE_119 false
 
+// Integer day-number phases
+#define PHASE_120 true
+#define PHASE_121 true
+
+// Batch conversion phases
+#define PHASE_122 true
+#define PHASE_123 true
+
+// Hebrew year information phases
+#define PHASE_124 true
+#define PHASE_125 true
+
+// Hebrew decoding phases
+#define PHASE_126 true
+#define PHASE_127 true
+
+// Day arithmetic phases
+#define PHASE_128 true
+#define PHASE_129 true
+#define PHASE_130 true
+#define PHASE_131 true
+
+// Exact Julian Day phases
+#define PHASE_132 true
+#define PHASE_133 true
+
+// Packed date phases
+#define PHASE_134 true
+#define PHASE_135 true
+
+// Formatting phases
+#define PHASE_136 true
+#define PHASE_137 true
+
+// Clock phases
+#define PHASE_138 true
+#define PHASE_139 true
+
+// ISO 8601 parsing phases
+#define PHASE_140 true
+#define PHASE_141 true
+
+// Benchmark phases
+#define PHASE_142 true
+#define PHASE_143 true
+
+// Table-driven Gregorian decoder phases
+#define PHASE_144 true
+#define PHASE_145 true
+#define PHASE_146 true
+#define PHASE_147 true
+
+// Constexpr conversion phases
+#define PHASE_148 true
+#define PHASE_149 true
+
+// Cross-calendar converter phases
+#define PHASE_150 true
+#define PHASE_151 true
+#define PHASE_152 true
+#define PHASE_153 true
+
+// Date range phases
+#define PHASE_154 true
+#define PHASE_155 true
+#define PHASE_156 true
+#define PHASE_157 true
+
+// Workday calendar phases
+#define PHASE_158 true
+#define PHASE_159 true
+#define PHASE_160 true
+#define PHASE_161 true
+
+// Recurrence phases
+#define PHASE_162 true
+#define PHASE_163 true
+#define PHASE_164 true
+#define PHASE_165 true
+
+// Jewish holiday phases
+#define PHASE_166 true
+#define PHASE_167 true
+#define PHASE_168 true
+
+// Tabular Islamic variant phases
+#define PHASE_169 true
+#define PHASE_170 true
+#define PHASE_171 true
+
+// Umm al-Qura phases
+#define PHASE_172 true
+#define PHASE_173 true
+#define PHASE_174 true
+#define PHASE_175 true
+
 
 
 /*============================================================================
 
 Revision History
 
+Version 1.2.0: 2026-10-16
+Added: Phases 120+ (performance features)
+
 Version 1.1.0: 2016-09-30
 Updated: Phase List
 
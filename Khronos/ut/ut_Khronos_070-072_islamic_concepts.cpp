@@ -58,7 +58,7 @@ GATS_TEST_CASE(ut070_test_Islamic_leapyear_test, ISLAMIC_CALENDAR_GROUP, oneThir
 GATS_TEST_CASE(ut071_test_islamic_leapyear, ISLAMIC_CALENDAR_GROUP, oneThird) {
 #if PHASE_71
 	using namespace khronos;
-	GATS_CHECK_EQUAL(is_islamic_leapyear(-5498), true);				// beginning of the Julian Epoch
+	GATS_CHECK_EQUAL(is_islamic_leapyear(-5498), false);			// beginning of the Julian Epoch (year 16 of its 30-year cycle)
 	GATS_CHECK_EQUAL(is_islamic_leapyear(1), false);				// Muharram 1, 1 A.H.
 	GATS_CHECK_EQUAL(is_islamic_leapyear(990), false);				// Gregorian adoption date Spain, Portugal, Polish-Lithuanian Commonwealth, Papal
 	GATS_CHECK_EQUAL(is_islamic_leapyear(1165), false);				// Gregorian adoption date British Empire
@@ -0,0 +1,118 @@
+/*	ut_Khronos_120-121_gregorian_jdn.cpp
+
+	Khronos library integer Gregorian <-> JDN kernels unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <sstream>
+using namespace std;
+
+
+
+/**	Test known Gregorian to JDN conversions, and the limits of the supported range. */
+GATS_TEST_CASE(ut120_test_gregorian_jdn_integer, GREGORIAN_CALENDAR_GROUP, 3) {
+#if PHASE_120
+	using namespace khronos;
+
+	auto test = [this](year_t year, month_t month, day_t day, jdn_t jdn, int line) {
+		auto result = gregorian_to_jdn(year, month, day);
+		ostringstream oss;
+		oss << "jdn(" << result << ") != expected(" << jdn << ") from line: " << line;
+		GATS_CHECK_MESSAGE(result == jdn, oss.str());
+
+		year_t y;
+		month_t m;
+		day_t d;
+		jdn_to_gregorian(jdn, y, m, d);
+		ostringstream ossYmd;
+		ossYmd << y << '-' << m << '-' << d << " != " << year << '-' << month << '-' << day << " from line: " << line;
+		GATS_CHECK_MESSAGE(y == year && m == month && d == day, ossYmd.str());
+	};
+
+	test(4714_BCE, November, 24, 0, __LINE__);				// beginning of the Julian Epoch
+	test(4714_BCE, November, 23, -1, __LINE__);
+	test(1_CE, January, 1, 1'721'426, __LINE__);				// January 1, 1 CE
+	test(1_BCE, December, 31, 1'721'425, __LINE__);
+	test(1_BCE, February, 29, 1'721'120 - 1, __LINE__);		// year 0 is a leap year
+	test(1582_CE, October, 15, 2'299'161, __LINE__);
+	test(1858_CE, November, 17, 2'400'001, __LINE__);
+	test(2000_CE, February, 29, 2'451'604, __LINE__);
+	test(2132_CE, August, 31, 2'500'000, __LINE__);
+
+	// compile-time evaluation
+	static_assert(gregorian_to_jdn(2012_CE, September, 14) == 2'456'185);
+
+	// the extremes of the supported range round-trip without overflow
+	for (year_t year : { GREGORIAN_JDN_MIN_YEAR, GREGORIAN_JDN_MIN_YEAR + 1, year_t(-1'000'000'000'000), year_t(1'000'000'000'000), GREGORIAN_JDN_MAX_YEAR - 1, GREGORIAN_JDN_MAX_YEAR }) {
+		for (month_t month : { January, February, March, December }) {
+			day_t day = gregorian_days_in_month(month, is_gregorian_leapyear(year));
+			year_t y;
+			month_t m;
+			day_t d;
+			jdn_t jdn = gregorian_to_jdn(year, month, day);
+			jdn_to_gregorian(jdn, y, m, d);
+			GATS_CHECK_EQUAL(y, year);
+			GATS_CHECK_EQUAL(m, month);
+			GATS_CHECK_EQUAL(d, day);
+			GATS_CHECK_EQUAL(gregorian_to_jdn(year, month, 1) + day - 1, jdn);
+		}
+	}
+#endif
+}
+
+
+
+/**	Check consecutive day numbers across several 400-year cycles against the double API. */
+GATS_TEST_CASE(ut121_test_gregorian_jdn_full, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_121
+	using namespace khronos;
+
+	cout << "Starting Gregorian JDN FULL_TEST: ";
+	year_t y;
+	month_t m;
+	day_t d;
+	jdn_to_gregorian(-1'000'000, y, m, d);
+	for (jdn_t jdn = -1'000'000; jdn <= 4'000'000; ++jdn) {
+		GATS_CHECK_EQUAL(gregorian_to_jdn(y, m, d), jdn);
+		GATS_CHECK_EQUAL(gregorian_to_jd(y, m, d), jdn - 0.5);
+
+		year_t yNext;
+		month_t mNext;
+		day_t dNext;
+		jdn_to_gregorian(jdn + 1, yNext, mNext, dNext);
+
+		// the next day is either the next day of the month, the first of the next month, or New Year's Day.
+		bool sameMonth = yNext == y && mNext == m && dNext == d + 1 && d < gregorian_days_in_month(m, is_gregorian_leapyear(y));
+		bool nextMonth = yNext == y && mNext == m + 1 && dNext == 1 && d == gregorian_days_in_month(m, is_gregorian_leapyear(y));
+		bool nextYear = yNext == y + 1 && m == December && d == 31 && mNext == January && dNext == 1;
+		GATS_CHECK(sameMonth || nextMonth || nextYear);
+
+		y = yNext;
+		m = mNext;
+		d = dNext;
+	}
+	cout << "... completed\n";
+#endif
+}
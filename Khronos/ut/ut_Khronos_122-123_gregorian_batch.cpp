@@ -0,0 +1,146 @@
+/*	ut_Khronos_122-123_gregorian_batch.cpp
+
+	Khronos library Gregorian batch conversion unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <vector>
+using namespace std;
+
+
+
+/**	Batch Gregorian to JD must be bit-identical to the scalar function on every instruction set. */
+GATS_TEST_CASE_SERIAL(ut122_test_batch_gregorian_to_jd, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_122
+	using namespace khronos;
+
+	// columns of random dates; the odd sizes exercise the scalar tails.
+	default_random_engine dr;
+	uniform_int_distribution<long long> modernYears(1600, 2400), wideYears(-3'000'000'000LL, 3'000'000'000LL);
+	uniform_int_distribution<int> monthDist(1, 12), dayDist(1, 28), hourDist(0, 23), minSecDist(0, 59);
+	size_t const n = 100'003;
+	vector<year_t> years(n);
+	vector<month_t> months(n);
+	vector<day_t> days(n);
+	vector<hour_t> hours(n);
+	vector<minute_t> minutes(n);
+	vector<second_t> seconds(n);
+	for (size_t i = 0; i < n; ++i) {
+		years[i] = i % 3 ? modernYears(dr) : wideYears(dr);
+		months[i] = monthDist(dr);
+		days[i] = dayDist(dr);
+		hours[i] = hourDist(dr);
+		minutes[i] = minSecDist(dr);
+		seconds[i] = minSecDist(dr) + (i % 7) / 8.0;
+	}
+	years[0] = -2'147'483'648LL;		// edges of the vector range
+	years[1] = 2'147'483'647LL;
+	years[2] = GREGORIAN_JDN_MAX_YEAR;	// scalar fall-back
+	months[3] = 13;						// invalid month, scalar fall-back
+
+	vector<jd_t> expectedDates(n), expectedTimes(n);
+	for (size_t i = 0; i < n; ++i) {
+		expectedDates[i] = gregorian_to_jd(years[i], months[i], days[i]);
+		expectedTimes[i] = gregorian_to_jd(years[i], months[i], days[i], hours[i], minutes[i], seconds[i]);
+	}
+
+	auto const original = batch::active_isa();
+	for (auto isa : { batch::Isa::scalar, batch::Isa::avx2, batch::Isa::avx512 }) {
+		if (batch::set_active_isa(isa) != isa)
+			continue;
+
+		vector<jd_t> dates(n), times(n);
+		batch::gregorian_to_jd(years, months, days, dates);
+		batch::gregorian_to_jd(years, months, days, hours, minutes, seconds, times);
+
+		ostringstream oss;
+		oss << "batch::gregorian_to_jd differs from scalar with isa: " << batch::isa_name(isa);
+		GATS_CHECK_MESSAGE(memcmp(dates.data(), expectedDates.data(), n * sizeof(jd_t)) == 0, oss.str());
+		GATS_CHECK_MESSAGE(memcmp(times.data(), expectedTimes.data(), n * sizeof(jd_t)) == 0, oss.str());
+	}
+	batch::set_active_isa(original);
+#endif
+}
+
+
+
+/**	Batch JD to Gregorian must be bit-identical to the scalar function on every instruction set. */
+GATS_TEST_CASE_SERIAL(ut123_test_batch_jd_to_gregorian, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_123
+	using namespace khronos;
+
+	// random JDs of modern and ancient dates, at awkward fractions of the day.
+	default_random_engine dr;
+	uniform_real_distribution<jd_t> modernJds(2'299'160.5, 2'500'000.5), wideJds(-2.5e9, 2.5e9);
+	size_t const n = 100'003;
+	vector<jd_t> jds(n);
+	for (size_t i = 0; i < n; ++i)
+		jds[i] = i % 3 ? modernJds(dr) : wideJds(dr);
+	jds[0] = -2'147'483'648.5;				// edges of the vector range
+	jds[1] = 2'147'483'646.5;
+	jds[2] = 1e15;							// scalar fall-back
+	jds[3] = 2'460'000.5 - 1e-7;			// rounds up to the end of the day
+	jds[4] = 2'460'000.5 + 0.5 / 86400;		// exactly half a second
+	jds[5] = -0.5;
+
+	vector<year_t> expectedYears(n), expectedTimeYears(n);
+	vector<month_t> expectedMonths(n), expectedTimeMonths(n);
+	vector<day_t> expectedDays(n), expectedTimeDays(n);
+	vector<hour_t> expectedHours(n);
+	vector<minute_t> expectedMinutes(n);
+	vector<second_t> expectedSeconds(n);
+	for (size_t i = 0; i < n; ++i) {
+		jd_to_gregorian(jds[i], expectedYears[i], expectedMonths[i], expectedDays[i]);
+		jd_to_gregorian(jds[i], expectedTimeYears[i], expectedTimeMonths[i], expectedTimeDays[i], expectedHours[i], expectedMinutes[i], expectedSeconds[i]);
+	}
+
+	auto const original = batch::active_isa();
+	for (auto isa : { batch::Isa::scalar, batch::Isa::avx2, batch::Isa::avx512 }) {
+		if (batch::set_active_isa(isa) != isa)
+			continue;
+
+		vector<year_t> years(n);
+		vector<month_t> months(n);
+		vector<day_t> days(n);
+		batch::jd_to_gregorian(jds, years, months, days);
+
+		ostringstream oss;
+		oss << "batch::jd_to_gregorian differs from scalar with isa: " << batch::isa_name(isa);
+		GATS_CHECK_MESSAGE(years == expectedYears && months == expectedMonths && days == expectedDays, oss.str());
+
+		vector<hour_t> hours(n);
+		vector<minute_t> minutes(n);
+		vector<second_t> seconds(n);
+		batch::jd_to_gregorian(jds, years, months, days, hours, minutes, seconds);
+		GATS_CHECK_MESSAGE(years == expectedTimeYears && months == expectedTimeMonths && days == expectedTimeDays, oss.str());
+		GATS_CHECK_MESSAGE(hours == expectedHours && minutes == expectedMinutes, oss.str());
+		GATS_CHECK_MESSAGE(memcmp(seconds.data(), expectedSeconds.data(), n * sizeof(second_t)) == 0, oss.str());
+	}
+	batch::set_active_isa(original);
+#endif
+}
@@ -0,0 +1,106 @@
+/*	ut_Khronos_124-125_hebrew_year_info.cpp
+
+	Khronos library Hebrew year information unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <atomic>
+#include <thread>
+#include <vector>
+using namespace std;
+
+
+
+/**	Year information must agree with the molad arithmetic and with the day-by-day conversions. */
+GATS_TEST_CASE(ut124_test_hebrew_year_info, HEBREW_CALENDAR_GROUP, 1) {
+#if PHASE_124
+	using namespace khronos;
+
+	// Rosh Hashanah 5784 .. 5787: September 16 2023, October 3 2024, September 23 2025, September 12 2026
+	GATS_CHECK_EQUAL(hebrew_year_info(5784).tishri1, gregorian_to_jdn(2023, 9, 16));
+	GATS_CHECK_EQUAL(hebrew_year_info(5785).tishri1, gregorian_to_jdn(2024, 10, 3));
+	GATS_CHECK_EQUAL(hebrew_year_info(5786).tishri1, gregorian_to_jdn(2025, 9, 23));
+	GATS_CHECK_EQUAL(hebrew_year_info(5787).tishri1, gregorian_to_jdn(2026, 9, 12));
+	GATS_CHECK_EQUAL(hebrew_year_info(5784).length, 383);
+	GATS_CHECK(hebrew_year_info(5784).leap);
+	GATS_CHECK_EQUAL(hebrew_year_info(5785).length, 355);
+	GATS_CHECK(!hebrew_year_info(5785).leap);
+	GATS_CHECK_EQUAL(hebrew_year_info(5786).length, 354);
+
+	for (year_t year = -2000; year <= 10'000; ++year) {
+		HebrewYearInfo const info = hebrew_year_info(year);
+		jd_t const tishri1 = HEBREW_EPOCH + hebrew_delay_of_week(year) + hebrew_delay_adjacent_year(year) + 2;
+		GATS_CHECK_EQUAL(info.year, year);
+		GATS_CHECK_EQUAL(static_cast<jd_t>(info.tishri1) - 0.5, tishri1);
+		GATS_CHECK_EQUAL(info.tishri1 + info.length, hebrew_year_info(year + 1).tishri1);
+		GATS_CHECK_EQUAL(info.leap, is_hebrew_leapyear(year));
+
+		// Months are contiguous in year order and fill the year.
+		day_t expected = 0;
+		for (month_t m = 7; m <= info.months_in_year(); ++m) {
+			GATS_CHECK_EQUAL(info.month_start(m), expected);
+			expected += info.days_in_month(m);
+		}
+		for (month_t m = 1; m < 7; ++m) {
+			GATS_CHECK_EQUAL(info.month_start(m), expected);
+			expected += info.days_in_month(m);
+		}
+		GATS_CHECK_EQUAL(expected, info.length);
+	}
+#endif
+}
+
+
+
+/**	Concurrent readers must always see complete, correct year information. */
+GATS_TEST_CASE(ut125_test_hebrew_year_info_threads, HEBREW_CALENDAR_GROUP, 1) {
+#if PHASE_125
+	using namespace khronos;
+
+	// Reference values, computed before any contention.
+	year_t const first = 1000;
+	year_t const last = 9000;	// spans several times the cache size, so slots are overwritten
+	vector<HebrewYearInfo> expected;
+	for (year_t year = first; year <= last; ++year)
+		expected.push_back(hebrew_year_info(year));
+
+	atomic<int> mismatches{ 0 };
+	vector<thread> threads;
+	for (int t = 0; t < 4; ++t)
+		threads.emplace_back([&, t] {
+			for (int pass = 0; pass < 8; ++pass)
+				for (year_t year = first + t; year <= last; year += 3) {
+					HebrewYearInfo const info = hebrew_year_info(year);
+					HebrewYearInfo const& ref = expected[static_cast<size_t>(year - first)];
+					if (info.year != ref.year || info.tishri1 != ref.tishri1 || info.length != ref.length || info.leap != ref.leap)
+						++mismatches;
+				}
+			});
+	for (auto& t : threads)
+		t.join();
+
+	GATS_CHECK_EQUAL(mismatches.load(), 0);
+#endif
+}
@@ -0,0 +1,116 @@
+/*	ut_Khronos_126-127_hebrew_decode.cpp
+
+	Khronos library Hebrew constant-time decoding unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+/**	Decode every day from year -2000 to 10000 and check it follows the previous day. */
+GATS_TEST_CASE(ut126_test_jdn_to_hebrew_full, HEBREW_CALENDAR_GROUP, 1) {
+#if PHASE_126
+	using namespace khronos;
+
+	jdn_t const first = hebrew_to_jdn(-2000, Tishri, 1);
+	jdn_t const last = hebrew_to_jdn(10'000, Tishri, 1);
+
+	year_t year = -2000;
+	month_t month = Tishri;
+	day_t day = 1;
+	for (jdn_t jdn = first; jdn < last; ++jdn) {
+		year_t y;
+		month_t m;
+		day_t d;
+		jdn_to_hebrew(jdn, y, m, d);
+		if (y != year || m != month || d != day) {
+			GATS_CHECK_EQUAL(y, year);
+			GATS_CHECK_EQUAL(m, month);
+			GATS_CHECK_EQUAL(d, day);
+			break;
+		}
+		GATS_CHECK_EQUAL(hebrew_to_jdn(y, m, d), jdn);
+
+		// Advance the expected date by one day.
+		if (day < hebrew_days_in_month(year, month))
+			++day;
+		else {
+			day = 1;
+			if (month == Elul) {
+				month = Tishri;
+				++year;
+			}
+			else if (month == hebrew_months_in_year(year))
+				month = Nisan;
+			else
+				++month;
+		}
+	}
+	GATS_CHECK_EQUAL(year, 10'000);
+#endif
+}
+
+
+
+/**	Batch decoding must match the scalar function, for calendar views and for random days. */
+GATS_TEST_CASE(ut127_test_batch_jd_to_hebrew, HEBREW_CALENDAR_GROUP, 1) {
+#if PHASE_127
+	using namespace khronos;
+
+	vector<jd_t> jds;
+	for (jd_t jd = 2'460'000.5; jd < 2'460'000.5 + 3 * 365; jd += 0.75)	// three years, three steps per two days
+		jds.push_back(jd);
+	default_random_engine dr;
+	uniform_real_distribution<jd_t> jdDist(-1'000'000.0, 5'000'000.0);
+	for (int i = 0; i < 10'000; ++i)
+		jds.push_back(jdDist(dr));
+
+	size_t const n = jds.size();
+	vector<year_t> years(n), expectedYears(n);
+	vector<month_t> months(n), expectedMonths(n);
+	vector<day_t> days(n), expectedDays(n);
+	vector<hour_t> hours(n), expectedHours(n);
+	vector<minute_t> minutes(n), expectedMinutes(n);
+	vector<second_t> seconds(n), expectedSeconds(n);
+	for (size_t i = 0; i < n; ++i)
+		jd_to_hebrew(jds[i], expectedYears[i], expectedMonths[i], expectedDays[i], expectedHours[i], expectedMinutes[i], expectedSeconds[i]);
+
+	batch::jd_to_hebrew(jds, years, months, days);
+	GATS_CHECK(years == expectedYears);
+	GATS_CHECK(months == expectedMonths);
+	GATS_CHECK(days == expectedDays);
+
+	batch::jd_to_hebrew(jds, years, months, days, hours, minutes, seconds);
+	GATS_CHECK(years == expectedYears);
+	GATS_CHECK(months == expectedMonths);
+	GATS_CHECK(days == expectedDays);
+	GATS_CHECK(hours == expectedHours);
+	GATS_CHECK(minutes == expectedMinutes);
+	GATS_CHECK(seconds == expectedSeconds);
+#endif
+}
@@ -0,0 +1,134 @@
+/*	ut_Khronos_128-129_gregorian_add_days.cpp
+
+	Khronos library Gregorian day arithmetic unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+/**	add_days must handle negative and very large offsets and keep the time of day. */
+GATS_TEST_CASE(ut128_test_gregorian_add_days, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_128
+	using namespace khronos;
+
+	static_assert(add_days(Gregorian(2000, 1, 1), 10).day() == 11);
+	static_assert(add_days(Gregorian(2000, 3, 1), -1).day() == 29);
+
+	auto check = [this](Gregorian const& date, int64_t n, Gregorian const& expected) {
+		Gregorian const result = add_days(date, n);
+		GATS_CHECK_EQUAL(result.year(), expected.year());
+		GATS_CHECK_EQUAL(result.month(), expected.month());
+		GATS_CHECK_EQUAL(result.day(), expected.day());
+		GATS_CHECK_EQUAL(result.hour(), expected.hour());
+		GATS_CHECK_EQUAL(result.minute(), expected.minute());
+		GATS_CHECK_EQUAL(result.second(), expected.second());
+	};
+
+	check(Gregorian(2000, 1, 1), 10, Gregorian(2000, 1, 11));
+	check(Gregorian(2000, 1, 1, 12, 13, 14.5), 10, Gregorian(2000, 1, 11, 12, 13, 14.5));
+	check(Gregorian(2000, 1, 1, 23, 59, 59), -1, Gregorian(1999, 12, 31, 23, 59, 59));
+	check(Gregorian(2024, 2, 28), 1, Gregorian(2024, 2, 29));
+	check(Gregorian(2023, 2, 28), 1, Gregorian(2023, 3, 1));
+	check(Gregorian(2000, 1, 1), 146'097, Gregorian(2400, 1, 1));
+	check(Gregorian(2000, 1, 1), -146'097 * 10, Gregorian(-2000, 1, 1));
+	check(Gregorian(1, 1, 1), -1, Gregorian(0, 12, 31));
+	check(Gregorian(2000, 1, 1), 146'097LL * 2'500'000'000LL, Gregorian(1'000'000'002'000, 1, 1));
+
+	// Agreement with Julian Day arithmetic.
+	default_random_engine dr;
+	uniform_int_distribution<int> jdnDist(-1'000'000, 5'000'000);
+	uniform_int_distribution<int> offsetDist(-3'000'000, 3'000'000);
+	for (int i = 0; i < 100'000; ++i) {
+		jdn_t const jdn = jdnDist(dr);
+		int64_t const n = offsetDist(dr);
+		year_t y;
+		month_t m;
+		day_t d;
+		jdn_to_gregorian(jdn, y, m, d);
+		Gregorian const result = add_days(Gregorian(y, m, d), n);
+		GATS_CHECK_EQUAL(gregorian_to_jdn(result.year(), result.month(), result.day()), jdn + n);
+	}
+#endif
+}
+
+
+
+/**	Batch add_days must match the scalar function, in place and out of place. */
+GATS_TEST_CASE_SERIAL(ut129_test_batch_gregorian_add_days, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_129
+	using namespace khronos;
+
+	batch::Isa const original = batch::active_isa();
+
+	default_random_engine dr;
+	uniform_int_distribution<int> jdnDist(-1'000'000, 5'000'000);
+	size_t const n = 10'000;
+	vector<year_t> years(n);
+	vector<month_t> months(n);
+	vector<day_t> days(n);
+	for (size_t i = 0; i < n; ++i)
+		jdn_to_gregorian(jdnDist(dr), years[i], months[i], days[i]);
+	years[17] = 5'000'000'000;	// beyond the vector kernels' range
+
+	for (int64_t offset : { 0LL, 1LL, -1LL, 36'524LL, -1'000'000LL, 4'000'000'000LL }) {
+		vector<year_t> expectedYears(n);
+		vector<month_t> expectedMonths(n);
+		vector<day_t> expectedDays(n);
+		for (size_t i = 0; i < n; ++i) {
+			Gregorian const g = add_days(Gregorian(years[i], months[i], days[i]), offset);
+			expectedYears[i] = g.year();
+			expectedMonths[i] = g.month();
+			expectedDays[i] = g.day();
+		}
+
+		for (batch::Isa isa : { batch::Isa::scalar, batch::Isa::avx2, batch::Isa::avx512 }) {
+			if (batch::set_active_isa(isa) != isa)
+				continue;
+
+			vector<year_t> y(n);
+			vector<month_t> m(n);
+			vector<day_t> d(n);
+			batch::add_days(years, months, days, offset, y, m, d);
+			GATS_CHECK(y == expectedYears);
+			GATS_CHECK(m == expectedMonths);
+			GATS_CHECK(d == expectedDays);
+
+			y = years;
+			m = months;
+			d = days;
+			batch::add_days(y, m, d, offset, y, m, d);
+			GATS_CHECK(y == expectedYears);
+			GATS_CHECK(m == expectedMonths);
+			GATS_CHECK(d == expectedDays);
+		}
+	}
+
+	batch::set_active_isa(original);
+#endif
+}
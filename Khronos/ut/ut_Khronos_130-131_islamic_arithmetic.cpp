@@ -0,0 +1,136 @@
+/*	ut_Khronos_130-131_islamic_arithmetic.cpp
+
+	Khronos library Islamic day and month arithmetic unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+/**	add_days and add_months must handle negative and large offsets and keep the time of day. */
+GATS_TEST_CASE(ut130_test_islamic_add_days_months, ISLAMIC_CALENDAR_GROUP, 1) {
+#if PHASE_130
+	using namespace khronos;
+
+	static_assert(islamic_to_jdn(1, Muharram, 1) == 1'948'440);
+
+	auto check = [this](Islamic const& result, Islamic const& expected) {
+		GATS_CHECK_EQUAL(result.year(), expected.year());
+		GATS_CHECK_EQUAL(result.month(), expected.month());
+		GATS_CHECK_EQUAL(result.day(), expected.day());
+		GATS_CHECK_EQUAL(result.hour(), expected.hour());
+		GATS_CHECK_EQUAL(result.minute(), expected.minute());
+		GATS_CHECK_EQUAL(result.second(), expected.second());
+	};
+
+	check(add_days(Islamic(1434, DhulHijja, 17), 100), Islamic(1435, RABI_AL_AWWAL, 28));
+	check(add_days(Islamic(1435, RABI_AL_AWWAL, 28, 6, 7, 8), -100), Islamic(1434, DhulHijja, 17, 6, 7, 8));
+	check(add_days(Islamic(1, Muharram, 1), -1), Islamic(0, DhulHijja, 29));
+	check(add_days(Islamic(1400, Muharram, 1), 10'631LL * 1'000'000), Islamic(30'001'400, Muharram, 1));
+
+	check(add_months(Islamic(1400, Muharram, 1), 13), Islamic(1401, SAFAR, 1));
+	check(add_months(Islamic(1401, SAFAR, 1), -13), Islamic(1400, Muharram, 1));
+	check(add_months(Islamic(1401, Muharram, 30), 1), Islamic(1401, SAFAR, 29));
+	check(add_months(Islamic(1434, DhulQadah, 30, 6, 7, 8), 1), Islamic(1434, DhulHijja, 30, 6, 7, 8));
+	check(add_months(Islamic(1433, DhulQadah, 30, 6, 7, 8), 1), Islamic(1433, DhulHijja, 29, 6, 7, 8));
+	check(add_months(Islamic(1, Muharram, 1), -1), Islamic(0, DhulHijja, 1));
+	check(add_months(Islamic(1, Muharram, 1), -12 * 5000 - 1), Islamic(-5000, DhulHijja, 1));
+	check(add_months(Islamic(1, Muharram, 1), 12LL * 1'000'000'000'000), Islamic(1'000'000'000'001, Muharram, 1));
+
+	// Agreement with Julian Day arithmetic and with the month lengths.
+	default_random_engine dr;
+	uniform_int_distribution<int> jdnDist(-1'000'000, 5'000'000);
+	uniform_int_distribution<int> offsetDist(-3'000'000, 3'000'000);
+	for (int i = 0; i < 100'000; ++i) {
+		jdn_t const jdn = jdnDist(dr);
+		int64_t const n = offsetDist(dr);
+		year_t y;
+		month_t m;
+		day_t d;
+		jdn_to_islamic(jdn, y, m, d);
+		GATS_CHECK_EQUAL(islamic_to_jdn(y, m, d), jdn);
+
+		Islamic const shifted = add_days(Islamic(y, m, d), n);
+		GATS_CHECK_EQUAL(islamic_to_jdn(shifted.year(), shifted.month(), shifted.day()), jdn + n);
+
+		Islamic const moved = add_months(Islamic(y, m, d), n / 30);
+		GATS_CHECK_EQUAL((moved.year() - y) * 12 + moved.month() - m, n / 30);
+		GATS_CHECK(moved.day() == d || (moved.day() < d && add_days(moved, 1).day() == 1));
+	}
+#endif
+}
+
+
+
+/**	Batch Islamic arithmetic must match the scalar functions, in place and out of place. */
+GATS_TEST_CASE(ut131_test_batch_islamic_arithmetic, ISLAMIC_CALENDAR_GROUP, 1) {
+#if PHASE_131
+	using namespace khronos;
+
+	default_random_engine dr;
+	uniform_int_distribution<int> jdnDist(-1'000'000, 5'000'000);
+	size_t const n = 10'000;
+	vector<year_t> years(n);
+	vector<month_t> months(n);
+	vector<day_t> days(n);
+	for (size_t i = 0; i < n; ++i)
+		jdn_to_islamic(jdnDist(dr), years[i], months[i], days[i]);
+
+	for (int64_t offset : { 0LL, 1LL, -1LL, 355LL, -1'000'000LL, 4'000'000'000LL }) {
+		vector<year_t> dayYears(n), monthYears(n);
+		vector<month_t> dayMonths(n), monthMonths(n);
+		vector<day_t> dayDays(n), monthDays(n);
+		for (size_t i = 0; i < n; ++i) {
+			Islamic const a = add_days(Islamic(years[i], months[i], days[i]), offset);
+			dayYears[i] = a.year();
+			dayMonths[i] = a.month();
+			dayDays[i] = a.day();
+			Islamic const b = add_months(Islamic(years[i], months[i], days[i]), offset);
+			monthYears[i] = b.year();
+			monthMonths[i] = b.month();
+			monthDays[i] = b.day();
+		}
+
+		vector<year_t> y(n);
+		vector<month_t> m(n);
+		vector<day_t> d(n);
+		batch::islamic_add_days(years, months, days, offset, y, m, d);
+		GATS_CHECK(y == dayYears);
+		GATS_CHECK(m == dayMonths);
+		GATS_CHECK(d == dayDays);
+
+		y = years;
+		m = months;
+		d = days;
+		batch::islamic_add_months(y, m, d, offset, y, m, d);
+		GATS_CHECK(y == monthYears);
+		GATS_CHECK(m == monthMonths);
+		GATS_CHECK(d == monthDays);
+	}
+#endif
+}
@@ -0,0 +1,127 @@
+/*	ut_Khronos_132-133_jd_exact.cpp
+
+	Khronos library exact Julian Day unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <random>
+#include <unordered_set>
+using namespace std;
+
+
+
+/**	Exact Julian Days: normalization, ordering, hashing and arithmetic. */
+GATS_TEST_CASE(ut132_test_JdExact_class, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_132
+	using namespace khronos;
+	int64_t const NS = JdExact::NS_PER_SECOND;
+	int64_t const DAY = JdExact::NS_PER_DAY;
+
+	static_assert(JdExact(10, -1).jdn() == 9);
+	static_assert(JdExact(10, -1).nanoseconds() == JdExact::NS_PER_DAY - 1);
+	static_assert(JdExact(10, 3 * JdExact::NS_PER_DAY + 5) == JdExact(13, 5));
+
+	// Ordering is exact at nanosecond resolution, far beyond the double's 40 us at JD 2.46M.
+	JdExact const a(2'460'000, 12 * 3'600 * NS);
+	JdExact const b(2'460'000, 12 * 3'600 * NS + 1);
+	GATS_CHECK(a < b);
+	GATS_CHECK(a != b);
+	GATS_CHECK(add_nanoseconds(a, 1) == b);
+	GATS_CHECK_EQUAL(nanoseconds_between(a, b), 1);
+	GATS_CHECK_EQUAL(nanoseconds_between(b, a), -1);
+	GATS_CHECK(add_nanoseconds(b, -DAY - 1) == JdExact(2'459'999, 12 * 3'600 * NS));
+	GATS_CHECK(add_days(a, -2'460'000) == JdExact(0, 12 * 3'600 * NS));
+	GATS_CHECK(a + days(1.5) == JdExact(2'460'002, 0));
+	GATS_CHECK(a - days(0.25) == JdExact(2'460'000, 6 * 3'600 * NS));
+	GATS_CHECK(a + weeks(2) == JdExact(2'460'014, 12 * 3'600 * NS));
+	GATS_CHECK_EQUAL(JdExact(2'460'010, 0) - a, 9.5);
+
+	unordered_set<JdExact> set{ a, b, a };
+	GATS_CHECK_EQUAL(set.size(), 2u);
+	GATS_CHECK(set.count(JdExact(2'460'000, 12 * 3'600 * NS + 1)) == 1);
+
+	// Jd round trip: midnight, noon and arbitrary times.
+	GATS_CHECK(JdExact(Jd(2'460'000.5)) == JdExact(2'460'001, 0));
+	GATS_CHECK(JdExact(Jd(2'460'000.0)) == JdExact(2'460'000, DAY / 2));
+	GATS_CHECK(JdExact(Jd(-0.5)) == JdExact(0, 0));
+	GATS_CHECK_EQUAL(JdExact(2'460'000, DAY / 4).jd(), 2'459'999.75);
+
+	default_random_engine dr;
+	uniform_real_distribution<jd_t> jdDist(1'000'000.0, 5'000'000.0);
+	for (int i = 0; i < 100'000; ++i) {
+		jd_t const jd = jdDist(dr);
+		GATS_CHECK_EQUAL(JdExact(Jd(jd)).jd(), jd);
+	}
+#endif
+}
+
+
+
+/**	Exact Julian Days convert losslessly to and from every calendar class. */
+GATS_TEST_CASE(ut133_test_JdExact_calendars, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_133
+	using namespace khronos;
+
+	static_assert(to_jd_exact(Gregorian(2000, 1, 1, 12, 0, 0)) == JdExact(2'451'545, JdExact::NS_PER_DAY / 2));
+	static_assert(to_gregorian(JdExact(2'451'545, 1)).second() == 1e-9);
+
+	Gregorian const g = to_gregorian(to_jd_exact(Gregorian(2024, 3, 1, 23, 59, 59.123456789)));
+	GATS_CHECK_EQUAL(g.year(), 2024);
+	GATS_CHECK_EQUAL(g.month(), 3);
+	GATS_CHECK_EQUAL(g.day(), 1);
+	GATS_CHECK_EQUAL(g.hour(), 23);
+	GATS_CHECK_EQUAL(g.minute(), 59);
+	GATS_CHECK(std::abs(g.second() - 59.123456789) < 1e-12);
+
+	// Every calendar agrees with its Julian Day conversions, for whole seconds of every hour.
+	default_random_engine dr;
+	uniform_int_distribution<jdn_t> jdnDist(-1'000'000, 5'000'000);
+	uniform_int_distribution<int> secondDist(0, 86'399);
+	for (int i = 0; i < 100'000; ++i) {
+		JdExact const x(jdnDist(dr), secondDist(dr) * JdExact::NS_PER_SECOND);
+		jd_t const jd = x.jd();
+
+		Gregorian const gr = to_gregorian(x);
+		GATS_CHECK(to_jd_exact(gr) == x);
+		GATS_CHECK_EQUAL(gregorian_to_jd(gr.year(), gr.month(), gr.day(), gr.hour(), gr.minute(), gr.second()), jd);
+
+		Julian const ju = to_julian(x);
+		GATS_CHECK(to_jd_exact(ju) == x);
+		GATS_CHECK_EQUAL(julian_to_jd(ju.year(), ju.month(), ju.day(), ju.hour(), ju.minute(), ju.second()), jd);
+
+		Islamic const is = to_islamic(x);
+		GATS_CHECK(to_jd_exact(is) == x);
+		GATS_CHECK_EQUAL(islamic_to_jd(is.year(), is.month(), is.day(), is.hour(), is.minute(), is.second()), jd);
+
+		auto const ia = to_islamic<IslamicLeap15, IslamicAstronomicalEpoch>(x);
+		GATS_CHECK(to_jd_exact(ia) == x);
+		GATS_CHECK_EQUAL((islamic_to_jd<IslamicLeap15, IslamicAstronomicalEpoch>(ia.year(), ia.month(), ia.day(), ia.hour(), ia.minute(), ia.second())), jd);
+
+		Hebrew const he = to_hebrew(x);
+		GATS_CHECK(to_jd_exact(he) == x);
+		GATS_CHECK_EQUAL(hebrew_to_jd(he.year(), he.month(), he.day(), he.hour(), he.minute(), he.second()), jd);
+	}
+#endif
+}
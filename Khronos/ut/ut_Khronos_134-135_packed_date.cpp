@@ -0,0 +1,128 @@
+/*	ut_Khronos_134-135_packed_date.cpp
+
+	Khronos library packed date unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <random>
+using namespace std;
+
+
+
+/**	Packed dates round-trip their fields and order chronologically as integers. */
+GATS_TEST_CASE(ut134_test_PackedDate, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_134
+	using namespace khronos;
+
+	static_assert(sizeof(PackedDate<Gregorian>) == 4);
+	static_assert(sizeof(PackedDateTime<Gregorian>) == 8);
+	static_assert(PackedDate<Gregorian>(Gregorian(2024, 2, 29)).unpack().day() == 29);
+	static_assert(PackedDate<Gregorian>(-4'000'000, 1, 1) < PackedDate<Gregorian>(4'000'000, 12, 31));
+
+	PackedDate<Gregorian> const p(Gregorian(-4713, 11, 24, 12, 0, 0));
+	GATS_CHECK_EQUAL(p.year(), -4713);
+	GATS_CHECK_EQUAL(p.month(), 11);
+	GATS_CHECK_EQUAL(p.day(), 24);
+	GATS_CHECK_EQUAL(Jd(p).jd(), -0.5);
+	GATS_CHECK(PackedDate<Gregorian>::from_bits(p.bits()) == p);
+
+	// Packed order matches Julian Day order, for every calendar.
+	default_random_engine dr;
+	uniform_int_distribution<jdn_t> jdnDist(-1'000'000, 5'000'000);
+	for (int i = 0; i < 100'000; ++i) {
+		jdn_t const a = jdnDist(dr);
+		jdn_t const b = jdnDist(dr);
+		year_t ya, yb;
+		month_t ma, mb;
+		day_t da, db;
+
+		jdn_to_gregorian(a, ya, ma, da);
+		jdn_to_gregorian(b, yb, mb, db);
+		PackedDate<Gregorian> const ga(ya, ma, da), gb(yb, mb, db);
+		GATS_CHECK((ga < gb) == (a < b));
+		GATS_CHECK(ga.year() == ya && ga.month() == ma && ga.day() == da);
+
+		jdn_to_julian(a, ya, ma, da);
+		jdn_to_julian(b, yb, mb, db);
+		GATS_CHECK((PackedDate<Julian>(ya, ma, da) < PackedDate<Julian>(yb, mb, db)) == (a < b));
+
+		jdn_to_islamic(a, ya, ma, da);
+		jdn_to_islamic(b, yb, mb, db);
+		GATS_CHECK((PackedDate<Islamic>(ya, ma, da) < PackedDate<Islamic>(yb, mb, db)) == (a < b));
+
+		jdn_to_hebrew(a, ya, ma, da);
+		jdn_to_hebrew(b, yb, mb, db);
+		PackedDate<Hebrew> const ha(ya, ma, da), hb(yb, mb, db);
+		GATS_CHECK((ha < hb) == (a < b));
+		GATS_CHECK(ha.year() == ya && ha.month() == ma && ha.day() == da);
+	}
+#endif
+}
+
+
+
+/**	Packed date-times keep the time of day to 1/10000 second and order chronologically. */
+GATS_TEST_CASE(ut135_test_PackedDateTime, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_135
+	using namespace khronos;
+
+	PackedDateTime<Gregorian> const p(Gregorian(2024, 3, 1, 23, 59, 59.1234));
+	GATS_CHECK_EQUAL(p.year(), 2024);
+	GATS_CHECK_EQUAL(p.month(), 3);
+	GATS_CHECK_EQUAL(p.day(), 1);
+	GATS_CHECK_EQUAL(p.hour(), 23);
+	GATS_CHECK_EQUAL(p.minute(), 59);
+	GATS_CHECK_EQUAL(p.second(), 59.1234);
+	GATS_CHECK(p.date() == PackedDate<Gregorian>(2024, 3, 1));
+	GATS_CHECK(PackedDateTime<Gregorian>(p.date()) < p);
+	GATS_CHECK(PackedDateTime<Gregorian>(2024, 3, 1, 23, 59, 59.99999).second() == 59.9999);
+
+	Gregorian const g = p.unpack();
+	GATS_CHECK(g.year() == 2024 && g.month() == 3 && g.day() == 1 && g.hour() == 23 && g.minute() == 59 && g.second() == 59.1234);
+
+	Hebrew const h = PackedDateTime<Hebrew>(Hebrew(5784, Veadar, 29, 18, 30, 15)).unpack();
+	GATS_CHECK(h.year() == 5784 && h.month() == Veadar && h.day() == 29 && h.hour() == 18 && h.minute() == 30 && h.second() == 15);
+
+	// The Islamic and Hebrew days begin at noon: the evening precedes the morning of the same date.
+	GATS_CHECK(PackedDateTime<Hebrew>(5784, Adar, 21, 18, 0, 0) < PackedDateTime<Hebrew>(5784, Adar, 21, 6, 0, 0));
+	GATS_CHECK(PackedDateTime<Islamic>(1445, 8, 20, 12, 0, 0) < PackedDateTime<Islamic>(1445, 8, 20, 0, 0, 0));
+	GATS_CHECK(PackedDateTime<Islamic>(1445, 8, 20, 11, 59, 59) < PackedDateTime<Islamic>(1445, 8, 21, 12, 0, 0));
+	GATS_CHECK(PackedDateTime<Islamic>(PackedDate<Islamic>(1445, 8, 20)).hour() == 0);
+	GATS_CHECK(PackedDateTime<Hebrew>(5784, Adar, 21, 23, 0, 0).hour() == 23);
+
+	// Packed order matches Julian Day order.
+	default_random_engine dr;
+	uniform_int_distribution<jdn_t> jdnDist(2'400'000, 2'400'010);
+	uniform_int_distribution<int> secondDist(0, 86'399);
+	for (int i = 0; i < 100'000; ++i) {
+		Jd const ja(static_cast<jd_t>(jdnDist(dr)) - 0.5 + secondDist(dr) / 86'400.0);
+		Jd const jb(static_cast<jd_t>(jdnDist(dr)) - 0.5 + secondDist(dr) / 86'400.0);
+		Gregorian const a(ja), b(jb);
+		GATS_CHECK((PackedDateTime<Gregorian>(a) < PackedDateTime<Gregorian>(b)) == (ja < jb));
+		GATS_CHECK((PackedDateTime<Islamic>(convert<Islamic>(a)) < PackedDateTime<Islamic>(convert<Islamic>(b))) == (ja < jb));
+		GATS_CHECK((PackedDateTime<Hebrew>(convert<Hebrew>(a)) < PackedDateTime<Hebrew>(convert<Hebrew>(b))) == (ja < jb));
+	}
+#endif
+}
@@ -0,0 +1,154 @@
+/*	ut_Khronos_136-137_format.cpp
+
+	Khronos library allocation-free formatting unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <cstdio>
+#include <iomanip>
+#include <iterator>
+#include <random>
+#include <sstream>
+using namespace std;
+
+
+
+namespace {
+	// Reference formatting, as the classes' to_string() produced it through iostreams.
+	string reference(khronos::Jd const& jd) {
+		ostringstream oss;
+		oss << "JD " << jd.jd();
+		return oss.str();
+	}
+
+	string reference(khronos::Gregorian const& g) {
+		ostringstream oss;
+		oss << khronos::day_name(khronos::day_of_week(g)) << ", " << khronos::civil::month_name_long(g.month()) << " " << g.day() << " ";
+		if (g.year() > 0)
+			oss << g.year() << " CE";
+		else
+			oss << std::abs(g.year() - 1) << " BCE";
+		oss << ", " << ((g.hour() % 12 == 0) ? 12 : g.hour() % 12) << ":"
+			<< setw(2) << setfill('0') << g.minute() << ":"
+			<< setw(2) << setfill('0') << static_cast<int>(g.second())
+			<< (g.hour() < 12 ? " am" : " pm");
+		return oss.str();
+	}
+
+	string reference(khronos::Hebrew const& h) {
+		ostringstream oss;
+		oss << khronos::hebrew_month_name(h.month()) << ' ' << (unsigned)h.day() << ' ' << h.year();
+		bool isAm = h.hour() < 12;
+		int hour = h.hour();
+		if (!isAm) hour -= 12;
+		if (hour == 0) hour = 12;
+		char buff[100];
+		snprintf(buff, 99, ", %d:%02d:%02.0f %s", hour, h.minute(), h.second(), isAm ? "am" : "pm");
+		oss << buff;
+		return oss.str();
+	}
+
+	template <class T>
+	string formatted(T const& value) {
+		char buffer[khronos::FORMAT_BUFFER_SIZE];
+		return string(buffer, khronos::format_to(buffer, buffer + khronos::FORMAT_BUFFER_SIZE, value));
+	}
+}
+
+
+
+/**	format_to writes exactly what the iostream-based formatting wrote. */
+GATS_TEST_CASE(ut136_test_format_to_matches_to_string, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_136
+	using namespace khronos;
+
+	GATS_CHECK_EQUAL(formatted(Jd(0)), string("JD 0"));
+	GATS_CHECK_EQUAL(formatted(Gregorian(2010, September, 12, 23, 45, 8)), string("Sunday, September 12 2010 CE, 11:45:08 pm"));
+	GATS_CHECK_EQUAL(formatted(Julian(2010, September, 12)), string("September 12, 2010"));
+	GATS_CHECK_EQUAL(formatted(Hebrew(2010, Heshvan, 12, 23, 45, 8)), string("Heshvan 12 2010, 11:45:08 pm"));
+	GATS_CHECK_EQUAL(formatted(JdExact(2'451'545, 1'500)), string("JDN 2451545 + 1500 ns"));
+
+	default_random_engine dr;
+	uniform_int_distribution<year_t> yearDist(-1'000'000, 1'000'000);
+	uniform_int_distribution<int> monthDist(1, 12);
+	uniform_int_distribution<int> dayDist(1, 28);
+	uniform_int_distribution<int> hourDist(0, 23);
+	uniform_int_distribution<int> minuteDist(0, 59);
+	uniform_real_distribution<double> secondDist(0.0, 59.5);
+	uniform_real_distribution<double> jdDist(-1e8, 1e8);
+	for (int i = 0; i < 100'000; ++i) {
+		Jd const jd(i % 2 ? jdDist(dr) : floor(jdDist(dr) / 1000.0) + 0.5);
+		GATS_CHECK_EQUAL(formatted(jd), reference(jd));
+		GATS_CHECK_EQUAL(jd.to_string(), reference(jd));
+
+		Gregorian const g(yearDist(dr), monthDist(dr), dayDist(dr), hourDist(dr), minuteDist(dr), secondDist(dr));
+		GATS_CHECK_EQUAL(formatted(g), reference(g));
+		GATS_CHECK_EQUAL(g.to_string(), reference(g));
+
+		Julian const j(yearDist(dr), monthDist(dr), dayDist(dr));
+		string const jRef = string(julian_month_name(j.month())) + " " + std::to_string(j.day()) + ", " + std::to_string(j.year());
+		GATS_CHECK_EQUAL(formatted(j), jRef);
+		GATS_CHECK_EQUAL(j.to_string(), jRef);
+
+		Hebrew const h(yearDist(dr), monthDist(dr) + i % 2, dayDist(dr), hourDist(dr), minuteDist(dr), secondDist(dr));
+		GATS_CHECK_EQUAL(formatted(h), reference(h));
+		GATS_CHECK_EQUAL(h.to_string(), reference(h));
+	}
+#endif
+}
+
+
+
+/**	format_to truncates to the buffer and writes through output iterators. */
+GATS_TEST_CASE(ut137_test_format_to_buffers_and_iterators, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_137
+	using namespace khronos;
+
+	Gregorian const g(2000, February, 29, 12, 30, 11);
+	string const expected("Tuesday, February 29 2000 CE, 12:30:11 pm");
+
+	// Truncation: never writes past 'last'.
+	char buffer[16] = "###############";
+	char* end = format_to(buffer, buffer + 7, g);
+	GATS_CHECK(end == buffer + 7);
+	GATS_CHECK(string(buffer, end) == "Tuesday");
+	GATS_CHECK(buffer[7] == '#');
+	GATS_CHECK(format_to(buffer, buffer, g) == buffer);
+
+	// Output iterators.
+	string s;
+	format_to(back_inserter(s), g);
+	GATS_CHECK_EQUAL(s, expected);
+
+	ostringstream oss;
+	format_to(ostreambuf_iterator<char>(oss), Hebrew(5784, Veadar, 29));
+	GATS_CHECK_EQUAL(oss.str(), string("Veadar 29 5784, 12:00:00 am"));
+
+	// Stream insertion uses the same path.
+	ostringstream exact;
+	exact << JdExact(-3, 7);
+	GATS_CHECK_EQUAL(exact.str(), string("JDN -3 + 7 ns"));
+#endif
+}
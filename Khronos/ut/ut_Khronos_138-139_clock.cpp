@@ -0,0 +1,151 @@
+/*	ut_Khronos_138-139_clock.cpp
+
+	Khronos library wall-clock service unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <atomic>
+#include <ctime>
+#include <thread>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	// A clock that stands still, counting the time-zone queries it answers.
+	class FixedSource : public khronos::clock::Source {
+	public:
+		khronos::clock::Instant instant{ 0, 0 };
+		int32_t offset = 0;
+		mutable atomic<int> offsetQueries{ 0 };
+
+		khronos::clock::Instant now() const override { return instant; }
+		int32_t utc_offset(int64_t) const override { ++offsetQueries; return offset; }
+	};
+}
+
+
+
+/**	A fixed source drives every 'now' constructor deterministically. */
+GATS_TEST_CASE_SERIAL(ut138_test_clock_fixed_source, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_138
+	using namespace khronos;
+
+	// 2024-03-01 04:34:56.25 UTC, observed five hours behind UTC (2024-02-29 23:34:56 local).
+	FixedSource fixed;
+	fixed.instant = { (gregorian_to_jdn(2024, 3, 1) - clock::UNIX_EPOCH_JDN) * 86'400 + 4 * 3600 + 34 * 60 + 56, 250'000'000 };
+	fixed.offset = -5 * 3600;
+	clock::set_source(&fixed);
+
+	GATS_CHECK_WITHIN(clock::utc_jd(), gregorian_to_jd(2024, 3, 1, 4, 34, 56.25), 1e-9);
+	GATS_CHECK_WITHIN(clock::local_jd(), gregorian_to_jd(2024, 2, 29, 23, 34, 56.25), 1e-9);
+
+	clock::LocalTime const lt = clock::local_time();
+	GATS_CHECK(lt.year == 2024 && lt.month == 2 && lt.day == 29);
+	GATS_CHECK(lt.hour == 23 && lt.minute == 34 && lt.second == 56);
+
+	GATS_CHECK_EQUAL(Jd().jd(), gregorian_to_jd(2024, 2, 29) + tod(23, 34, 56));
+	GATS_CHECK_EQUAL(Jd(NOTIMEOFDAY).jd(), gregorian_to_jd(2024, 2, 29));
+	GATS_CHECK(Gregorian() == Gregorian(2024, 2, 29, 23, 34, 56));
+	GATS_CHECK(Gregorian(NOTIMEOFDAY) == Gregorian(2024, 2, 29));
+	GATS_CHECK_WITHIN(Jd(Julian()).jd(), gregorian_to_jd(2024, 2, 29, 23, 34, 56), 1e-9);
+
+	Islamic const islamic;
+	Islamic const islamicToday(NOTIMEOFDAY);
+	year_t y;
+	month_t m;
+	day_t d;
+	jd_to_islamic(gregorian_to_jd(2024, 2, 29, 23, 34, 56), y, m, d);
+	GATS_CHECK(islamic.year() == y && islamic.month() == m && islamic.day() == d && islamic.hour() == 23);
+	jd_to_islamic(gregorian_to_jd(2024, 2, 29), y, m, d);
+	GATS_CHECK(islamicToday.year() == y && islamicToday.month() == m && islamicToday.day() == d && islamicToday.hour() == 0);
+
+	// The time zone is consulted once per second, not once per reading.
+	fixed.offsetQueries = 0;
+	for (int i = 0; i < 1000; ++i)
+		(void)clock::local_jd();
+	GATS_CHECK_EQUAL(fixed.offsetQueries.load(), 0);
+	fixed.instant.seconds += 1;
+	for (int i = 0; i < 1000; ++i)
+		(void)clock::local_jd();
+	GATS_CHECK_EQUAL(fixed.offsetQueries.load(), 1);
+
+	// Selecting a source discards the offset cached for the current second.
+	fixed.offset = 2 * 3600;
+	clock::set_source(&fixed);
+	GATS_CHECK_WITHIN(clock::local_jd(), gregorian_to_jd(2024, 3, 1, 6, 34, 57.25), 1e-9);
+	GATS_CHECK_EQUAL(fixed.offsetQueries.load(), 2);
+
+	// Negative instants (before 1970).
+	fixed.instant = { -1, 500'000'000 };
+	fixed.offset = 0;
+	clock::set_source(&fixed);
+	GATS_CHECK_WITHIN(clock::utc_jd(), gregorian_to_jd(1969, 12, 31, 23, 59, 59.5), 1e-9);
+
+	clock::set_source(nullptr);
+#endif
+}
+
+
+
+/**	The system source agrees with the C library and serves many threads. */
+GATS_TEST_CASE_SERIAL(ut139_test_clock_system_source, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_139
+	using namespace khronos;
+
+	clock::set_source(nullptr);
+	time_t const before = time(NULL);
+	clock::Instant const now = clock::now();
+	time_t const after = time(NULL);
+	GATS_CHECK(now.seconds >= before && now.seconds <= after);
+	GATS_CHECK(now.nanoseconds >= 0 && now.nanoseconds < 1'000'000'000);
+
+	jd_t const utc = clock::utc_jd();
+	GATS_CHECK_WITHIN(utc, clock::UNIX_EPOCH_JDN - 0.5 + before / 86'400.0, 5.0 / 86'400);
+	GATS_CHECK(std::abs(clock::local_jd() - utc) <= 1.0);
+
+	// Readings never go backwards within a thread and agree with the constructors.
+	atomic<int> failures{ 0 };
+	vector<thread> threads;
+	for (int t = 0; t < 4; ++t)
+		threads.emplace_back([&failures] {
+			jd_t last = clock::utc_jd();
+			for (int i = 0; i < 10'000; ++i) {
+				jd_t const next = clock::utc_jd();
+				if (next < last)
+					++failures;
+				last = next;
+				jd_t const local = clock::local_jd();
+				Jd const constructed;
+				if (std::abs(constructed.jd() - local) > 2.0 / 86'400)
+					++failures;
+			}
+		});
+	for (auto& t : threads)
+		t.join();
+	GATS_CHECK_EQUAL(failures.load(), 0);
+#endif
+}
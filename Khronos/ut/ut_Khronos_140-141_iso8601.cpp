@@ -0,0 +1,147 @@
+/*	ut_Khronos_140-141_iso8601.cpp
+
+	Khronos library ISO 8601 parser unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+using namespace std;
+
+
+
+/**	Single dates and date-times parse to gregorian_to_jd of their fields. */
+GATS_TEST_CASE(ut140_test_parse_iso8601, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_140
+	using namespace khronos;
+
+	GATS_CHECK_EQUAL(parse_iso8601("2024-03-01").value().jd(), gregorian_to_jd(2024, 3, 1));
+	GATS_CHECK_EQUAL(parse_iso8601("2024-03-01T12:34:56").value().jd(), gregorian_to_jd(2024, 3, 1, 12, 34, 56));
+	GATS_CHECK_EQUAL(parse_iso8601("2024-03-01 12:34").value().jd(), gregorian_to_jd(2024, 3, 1, 12, 34, 0));
+	GATS_CHECK_EQUAL(parse_iso8601("2024-03-01T12:34:56.250").value().jd(), gregorian_to_jd(2024, 3, 1, 12, 34, 56.25));
+	GATS_CHECK_EQUAL(parse_iso8601("2024-03-01T12:34:56,5Z").value().jd(), gregorian_to_jd(2024, 3, 1, 12, 34, 56.5));
+	GATS_CHECK_EQUAL(parse_iso8601("2024-03-01T12:34:56+05:30").value().jd(), gregorian_to_jd(2024, 3, 1, 12, 34 - 330, 56));
+	GATS_CHECK_EQUAL(parse_iso8601("2024-03-01T12:34:56-0800").value().jd(), gregorian_to_jd(2024, 3, 1, 12, 34 + 480, 56));
+
+	// Astronomical years: 0000 is 1 BCE, -0001 is 2 BCE.
+	GATS_CHECK_EQUAL(parse_iso8601("0000-01-01").value().jd(), gregorian_to_jd(1_BCE, 1, 1));
+	GATS_CHECK_EQUAL(parse_iso8601("-0001-12-31").value().jd(), gregorian_to_jd(2_BCE, 12, 31));
+	GATS_CHECK_EQUAL(parse_iso8601("-4713-11-24T12:00:00").value().jd(), 0.0);
+	GATS_CHECK_EQUAL(parse_iso8601("+123456-07-04").value().jd(), gregorian_to_jd(123'456, 7, 4));
+
+	// Rejections.
+	GATS_CHECK(parse_iso8601("2024-02-30").error() == ParseError::invalid_date);
+	GATS_CHECK(parse_iso8601("2023-02-29").error() == ParseError::invalid_date);
+	GATS_CHECK(parse_iso8601("2024-13-01").error() == ParseError::invalid_date);
+	GATS_CHECK(parse_iso8601("2024-03-01T24:00:00").error() == ParseError::invalid_time);
+	GATS_CHECK(parse_iso8601("2024-03-01T12:60").error() == ParseError::invalid_time);
+	GATS_CHECK(parse_iso8601("2024-3-01").error() == ParseError::syntax);
+	GATS_CHECK(parse_iso8601("20240-03-01").error() == ParseError::syntax);
+	GATS_CHECK(parse_iso8601("2024-03-01T").error() == ParseError::syntax);
+	GATS_CHECK(parse_iso8601("2024-03-01T12:34:56.").error() == ParseError::syntax);
+	GATS_CHECK(parse_iso8601("2024-03-01x").error() == ParseError::syntax);
+	GATS_CHECK(parse_iso8601("2024/03/01").error() == ParseError::syntax);
+	GATS_CHECK(parse_iso8601("").error() == ParseError::syntax);
+	GATS_CHECK(parse_iso8601("+99999999999999999-01-01").error() == ParseError::year_out_of_range);
+	GATS_CHECK(parse_iso8601("+1234567890123456789-01-01").error() == ParseError::year_out_of_range);
+	GATS_CHECK(!parse_iso8601("2024-0a-01"));
+
+	// Round trip through formatted random date-times.
+	default_random_engine dr;
+	uniform_int_distribution<year_t> yearDist(-9999, 9999);
+	uniform_int_distribution<int> monthDist(1, 12);
+	uniform_int_distribution<int> dayDist(1, 28);
+	uniform_int_distribution<int> hourDist(0, 23);
+	uniform_int_distribution<int> minuteDist(0, 59);
+	uniform_int_distribution<int> milliDist(0, 59'999);
+	for (int i = 0; i < 100'000; ++i) {
+		year_t const y = yearDist(dr);
+		int const m = monthDist(dr), d = dayDist(dr), h = hourDist(dr), mi = minuteDist(dr), ms = milliDist(dr);
+		char text[64];
+		snprintf(text, sizeof(text), "%s%04lld-%02d-%02dT%02d:%02d:%02d.%03d", y < 0 ? "-" : "", std::abs(y), m, d, h, mi, ms / 1000, ms % 1000);
+		ParseResult const r = parse_iso8601(text);
+		GATS_CHECK(r.has_value());
+		GATS_CHECK_EQUAL(r.value().jd(), gregorian_to_jd(y, m, d, h, mi, ms / 1000 + (ms % 1000) / 1e3));
+	}
+#endif
+}
+
+
+
+/**	Bulk parsing fills Julian Day and date columns, flagging bad records. */
+GATS_TEST_CASE(ut141_test_parse_iso8601_bulk, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_141
+	using namespace khronos;
+
+	string const text = "2024-03-01T12:00:00,1999-12-31\r\nbad\n\n-0044-03-15T10:30:00+01:00\n";
+
+	vector<jd_t> jds;
+	GATS_CHECK_EQUAL(parse_iso8601(text, jds), size_t(1));
+	GATS_CHECK_EQUAL(jds.size(), size_t(4));
+	GATS_CHECK_EQUAL(jds[0], gregorian_to_jd(2024, 3, 1, 12, 0, 0));
+	GATS_CHECK_EQUAL(jds[1], gregorian_to_jd(1999, 12, 31));
+	GATS_CHECK(std::isnan(jds[2]));
+	GATS_CHECK_EQUAL(jds[3], gregorian_to_jd(-44, 3, 15, 10, 30 - 60, 0));
+
+	vector<year_t> years;
+	vector<month_t> months;
+	vector<day_t> days;
+	vector<hour_t> hours;
+	vector<minute_t> minutes;
+	vector<second_t> seconds;
+	GATS_CHECK_EQUAL(parse_iso8601(text, years, months, days, hours, minutes, seconds), size_t(1));
+	GATS_CHECK_EQUAL(years.size(), size_t(4));
+	GATS_CHECK(years[3] == -44 && months[3] == 3 && days[3] == 15 && hours[3] == 10 && minutes[3] == -30);
+	GATS_CHECK(months[2] == 0);
+
+	// The columns convert to the same Julian Days.
+	vector<jd_t> converted(years.size());
+	batch::gregorian_to_jd(years, months, days, hours, minutes, seconds, converted);
+	GATS_CHECK_EQUAL(converted[0], jds[0]);
+	GATS_CHECK_EQUAL(converted[3], jds[3]);
+
+	// A large generated buffer parses with no failures.
+	string big;
+	for (int i = 0; i < 100'000; ++i) {
+		year_t y;
+		month_t m;
+		day_t d;
+		jdn_to_gregorian(2'400'000 + i, y, m, d);
+		char record[32];
+		snprintf(record, sizeof(record), "%04lld-%02d-%02dT%02d:%02d:%02d\n", y, m, d, i % 24, i % 60, i % 59);
+		big += record;
+	}
+	jds.clear();
+	GATS_CHECK_EQUAL(parse_iso8601(big, jds), size_t(0));
+	GATS_CHECK_EQUAL(jds.size(), size_t(100'000));
+	year_t y;
+	month_t m;
+	day_t d;
+	jdn_to_gregorian(2'499'999, y, m, d);
+	GATS_CHECK_EQUAL(jds[99'999], gregorian_to_jd(y, m, d, 99'999 % 24, 99'999 % 60, 99'999 % 59));
+#endif
+}
@@ -0,0 +1,88 @@
+/*	ut_Khronos_142-143_benchmarks.cpp
+
+	Khronos library conversion benchmarks.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <limits>
+using namespace std;
+
+
+
+/**	Median limits are only asserted in optimized builds. */
+constexpr double release_limit_ns([[maybe_unused]] double ns) {
+#if defined(NDEBUG)
+	return ns;
+#else
+	return numeric_limits<double>::infinity();
+#endif
+}
+
+
+
+/**	Decode successive days of the modern era. */
+GATS_BENCHMARK(ut142_bench_jd_to_gregorian, GREGORIAN_CALENDAR_GROUP, release_limit_ns(100.0)) {
+#if PHASE_142
+	using namespace khronos;
+
+	static jd_t jd = 2'415'020.5;
+	jd = jd < 2'488'069.5 ? jd + 1.0 : 2'415'020.5;
+	gats::do_not_optimize(jd);
+
+	year_t year;
+	month_t month;
+	day_t day;
+	jd_to_gregorian(jd, year, month, day);
+	gats::do_not_optimize(year);
+	gats::do_not_optimize(month);
+	gats::do_not_optimize(day);
+#endif
+}
+
+
+
+/**	Encode successive days of the modern era. */
+GATS_BENCHMARK(ut143_bench_gregorian_to_jd, GREGORIAN_CALENDAR_GROUP, release_limit_ns(100.0)) {
+#if PHASE_143
+	using namespace khronos;
+
+	static year_t year = 1900;
+	static month_t month = January;
+	static day_t day = 1;
+	if (++day > 28) {
+		day = 1;
+		if (++month > December) {
+			month = January;
+			year = year < 2100 ? year + 1 : 1900;
+		}
+	}
+	gats::do_not_optimize(year);
+	gats::do_not_optimize(month);
+	gats::do_not_optimize(day);
+
+	jd_t jd = gregorian_to_jd(year, month, day);
+	gats::do_not_optimize(jd);
+#endif
+}
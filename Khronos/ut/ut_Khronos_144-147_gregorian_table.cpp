@@ -0,0 +1,164 @@
+/*	ut_Khronos_144-147_gregorian_table.cpp
+
+	Khronos library table-driven Gregorian decoder unit test and benchmarks.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	// The table decoder is usable in constant expressions.
+	constexpr bool table_decodes(khronos::jdn_t jdn, khronos::year_t y, khronos::month_t m, khronos::day_t d) {
+		khronos::year_t year{};
+		khronos::month_t month{};
+		khronos::day_t day{};
+		khronos::jdn_to_gregorian_table(jdn, year, month, day);
+		return year == y && month == m && day == d;
+	}
+	static_assert(table_decodes(2'451'545, 2000, 1, 1));
+	static_assert(table_decodes(2'460'370, 2024, 2, 29));
+	static_assert(table_decodes(0, -4713, 11, 24));
+	static_assert(table_decodes(-1, -4713, 11, 23));
+
+
+
+	// Random JDNs spanning 100,000 BCE to 100,000 CE, for random-access decoding.
+	vector<khronos::jdn_t> const& random_jdns() {
+		static vector<khronos::jdn_t> const jdns = [] {
+			mt19937_64 rng(144);
+			uniform_int_distribution<khronos::jdn_t> dist(-34'802'000, 38'245'000);
+			vector<khronos::jdn_t> v(4096);
+			for (auto& jdn : v)
+				jdn = dist(rng);
+			return v;
+		}();
+		return jdns;
+	}
+}
+
+
+
+/**	The table decoder agrees with the arithmetic decoder. */
+GATS_TEST_CASE(ut144_test_jdn_to_gregorian_table, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_144
+	using namespace khronos;
+
+	auto agree = [](jdn_t jdn) {
+		year_t y1, y2;
+		month_t m1, m2;
+		day_t d1, d2;
+		jdn_to_gregorian(jdn, y1, m1, d1);
+		jdn_to_gregorian_table(jdn, y2, m2, d2);
+		return y1 == y2 && m1 == m2 && d1 == d2;
+	};
+
+	// Every day of three whole cycles, spanning negative and positive eras.
+	bool all = true;
+	for (jdn_t jdn = -146'097 * 2 + 1'721'120 - 7; jdn < 146'097 + 1'721'120 + 7; ++jdn)
+		all = all && agree(jdn);
+	GATS_CHECK(all);
+
+	for (auto jdn : random_jdns())
+		GATS_CHECK_MESSAGE(agree(jdn), "JDN " << jdn);
+#endif
+}
+
+
+
+/**	jd_to_gregorian gives the same results with either decoder selected. */
+GATS_TEST_CASE_SERIAL(ut145_test_gregorian_decoder_selection, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_145
+	using namespace khronos;
+
+	GregorianDecoder const original = gregorian_decoder();
+	GATS_CHECK(set_gregorian_decoder(GregorianDecoder::table) == original);
+	GATS_CHECK(gregorian_decoder() == GregorianDecoder::table);
+
+	for (auto jdn : random_jdns()) {
+		jd_t const jd = jdn - 0.5 + 0.3;
+		year_t y1, y2;
+		month_t m1, m2;
+		day_t d1, d2;
+		hour_t h1, h2;
+		minute_t mi1, mi2;
+		second_t s1, s2;
+		set_gregorian_decoder(GregorianDecoder::table);
+		jd_to_gregorian(jd, y1, m1, d1, h1, mi1, s1);
+		set_gregorian_decoder(GregorianDecoder::arithmetic);
+		jd_to_gregorian(jd, y2, m2, d2, h2, mi2, s2);
+		GATS_CHECK_MESSAGE(y1 == y2 && m1 == m2 && d1 == d2 && h1 == h2 && mi1 == mi2 && s1 == s2, "JD " << jd);
+	}
+
+	GATS_CHECK(set_gregorian_decoder(original) == GregorianDecoder::arithmetic);
+#endif
+}
+
+
+
+/**	Random-access decode with the arithmetic decoder. */
+GATS_BENCHMARK(ut146_bench_jdn_to_gregorian_arithmetic, GREGORIAN_CALENDAR_GROUP) {
+#if PHASE_146
+	using namespace khronos;
+
+	static size_t i = 0;
+	i = (i + 1) & 4095;
+	jdn_t jdn = random_jdns()[i];
+	gats::do_not_optimize(jdn);
+
+	year_t year;
+	month_t month;
+	day_t day;
+	jdn_to_gregorian(jdn, year, month, day);
+	gats::do_not_optimize(year);
+	gats::do_not_optimize(month);
+	gats::do_not_optimize(day);
+#endif
+}
+
+
+
+/**	Random-access decode with the table decoder. */
+GATS_BENCHMARK(ut147_bench_jdn_to_gregorian_table, GREGORIAN_CALENDAR_GROUP) {
+#if PHASE_147
+	using namespace khronos;
+
+	static size_t i = 0;
+	i = (i + 1) & 4095;
+	jdn_t jdn = random_jdns()[i];
+	gats::do_not_optimize(jdn);
+
+	year_t year;
+	month_t month;
+	day_t day;
+	jdn_to_gregorian_table(jdn, year, month, day);
+	gats::do_not_optimize(year);
+	gats::do_not_optimize(month);
+	gats::do_not_optimize(day);
+#endif
+}
@@ -0,0 +1,140 @@
+/*	ut_Khronos_148-149_constexpr.cpp
+
+	Khronos library constexpr conversion and date literal unit test.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+using namespace std;
+
+
+
+namespace {
+	using namespace khronos;
+
+	// Every calendar converts to and from a Jd in a constant expression.
+	static_assert(gregorian_to_jd(2000, 1, 1) == 2'451'544.5);
+	static_assert(gregorian_to_jd(2000, 1, 1, 12, 0, 0) == 2'451'545.0);
+	static_assert(julian_to_jd(2000, 1, 1) == 2'451'557.5);
+	static_assert(islamic_to_jd(1445, 9, 1) == 2'460'380.5);
+	static_assert(hebrew_to_jd(5784, 7, 1) == 2'460'203.5);
+	static_assert(jd_to_jdn(2'451'544.5) == 2'451'545.0);
+	static_assert(Jd(Gregorian(2024, 3, 1)) == Jd(2'460'370.5));
+	static_assert(Jd(Julian(2024, 2, 17)) == Jd(2'460'370.5));
+	static_assert(Jd(Islamic(1445, 8, 20)) == Jd(2'460'370.5));
+	static_assert(Jd(Hebrew(5784, 12, 21)) == Jd(2'460'370.5));
+
+	struct Ymdhms {
+		year_t year;
+		month_t month;
+		day_t day;
+		hour_t hour;
+		minute_t minute;
+		second_t second;
+		constexpr bool operator==(Ymdhms const&) const = default;
+	};
+
+	template <void (*Convert)(jd_t, year_t&, month_t&, day_t&, hour_t&, minute_t&, second_t&)>
+	constexpr Ymdhms decode(jd_t jd) {
+		Ymdhms r{};
+		Convert(jd, r.year, r.month, r.day, r.hour, r.minute, r.second);
+		return r;
+	}
+	static_assert(decode<jd_to_gregorian>(2'460'371.25) == Ymdhms{ 2024, 3, 1, 18, 0, 0 });
+	static_assert(decode<jd_to_gregorian>(-0.5) == Ymdhms{ -4713, 11, 24, 0, 0, 0 });
+	static_assert(decode<jd_to_julian>(2'460'371.25) == Ymdhms{ 2024, 2, 17, 18, 0, 0 });
+	static_assert(decode<jd_to_islamic>(2'460'370.5) == Ymdhms{ 1445, 8, 20, 0, 0, 0 });
+	static_assert(decode<jd_to_hebrew>(2'460'370.5) == Ymdhms{ 5784, 12, 21, 0, 0, 0 });
+
+	// Date literals are evaluated at compile time.
+	static_assert("2024-03-01"_greg == Jd(2'460'370.5));
+	static_assert("2024-02-17"_jul == "2024-03-01"_greg);
+	static_assert("1445-08-20"_isl == "2024-03-01"_greg);
+	static_assert("5784-07-01"_heb == "2023-09-16"_greg);
+	static_assert("5784-13-29"_heb == "2024-04-08"_greg);
+	static_assert("-4713-11-24"_greg == Jd(-0.5));
+	static_assert("+2000-01-01"_greg == Jd(2'451'544.5));
+
+	// Islamic years before the era: -4 is a leap year, -100 is not.
+	static_assert("-0004-12-30"_isl.jd() + 1 == "-0003-01-01"_isl.jd());
+	static_assert("-0100-12-29"_isl.jd() + 1 == "-0099-01-01"_isl.jd());
+}
+
+
+
+/**	The run-time conversions agree with the compile-time results. */
+GATS_TEST_CASE(ut148_test_constexpr_conversions, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_148
+	using namespace khronos;
+
+	constexpr jd_t greg = gregorian_to_jd(2024, 3, 1, 18, 30, 15);
+	constexpr jd_t heb = hebrew_to_jd(5785, 7, 1);
+	jd_t const gregRuntime = gregorian_to_jd(2024, 3, 1, 18, 30, 15);
+	jd_t const hebRuntime = hebrew_to_jd(5785, 7, 1);
+	GATS_CHECK_EQUAL(greg, gregRuntime);
+	GATS_CHECK_EQUAL(heb, hebRuntime);
+
+	// Compile-time and run-time decoding agree across the supported range of every calendar.
+	for (jd_t jd = -1'000'000.5; jd < 4'000'000.0; jd += 997.25) {
+		year_t y1, y2;
+		month_t m1, m2;
+		day_t d1, d2;
+		hour_t h1, h2;
+		minute_t mi1, mi2;
+		second_t s1, s2;
+
+		jd_to_gregorian(jd, y1, m1, d1, h1, mi1, s1);
+		GATS_CHECK(gregorian_to_jd(y1, m1, d1, h1, mi1, s1) == jd);
+
+		jd_to_julian(jd, y2, m2, d2, h2, mi2, s2);
+		GATS_CHECK(julian_to_jd(y2, m2, d2, h2, mi2, s2) == jd);
+
+		jd_to_hebrew(jd, y1, m1, d1);
+		GATS_CHECK(hebrew_to_jdn(y1, m1, d1) == static_cast<jdn_t>(floor(jd + 1.0)));
+
+		jd_to_islamic(jd, y2, m2, d2);
+		GATS_CHECK(islamic_to_jdn(y2, m2, d2) == static_cast<jdn_t>(floor(jd) + 1));
+	}
+#endif
+}
+
+
+
+/**	Date literals match the equivalent conversion calls. */
+GATS_TEST_CASE(ut149_test_date_literals, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_149
+	using namespace khronos;
+
+	GATS_CHECK_EQUAL("2024-03-01"_greg.jd(), gregorian_to_jd(2024, 3, 1));
+	GATS_CHECK_EQUAL("2024-02-29"_greg.jd(), gregorian_to_jd(2024, 2, 29));
+	GATS_CHECK_EQUAL("-0044-03-15"_jul.jd(), julian_to_jd(-44, 3, 15));
+	GATS_CHECK_EQUAL("1445-09-01"_isl.jd(), islamic_to_jd(1445, 9, 1));
+	GATS_CHECK_EQUAL("-0004-12-30"_isl.jd(), islamic_to_jd(-4, 12, 30));
+	GATS_CHECK_EQUAL("-0100-12-29"_isl.jd(), islamic_to_jd(-100, 12, 29));
+	GATS_CHECK_EQUAL("5784-07-01"_heb.jd(), hebrew_to_jd(5784, Tishri, 1));
+	GATS_CHECK_EQUAL("5785-08-30"_heb.jd(), hebrew_to_jd(5785, Heshvan, 30));
+
+	GATS_CHECK(Gregorian("2024-03-01"_greg) == Gregorian(2024, 3, 1));
+	GATS_CHECK(Julian("2024-02-17"_jul).day() == 17);
+#endif
+}
@@ -0,0 +1,189 @@
+/*	ut_Khronos_150-153_convert.cpp
+
+	Khronos library cross-calendar converter unit test and benchmark.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	using namespace khronos;
+
+	static_assert(Calendar<Gregorian>);
+	static_assert(Calendar<Julian>);
+	static_assert(Calendar<Islamic>);
+	static_assert(Calendar<Hebrew>);
+	static_assert(!Calendar<Jd>);
+	static_assert(DayNumberCalendar<Hebrew>);
+
+	// Conversions are usable in constant expressions.
+	static_assert(convert<Julian>(Gregorian(2024, 3, 1)).day() == 17);
+	static_assert(convert<Gregorian>(Julian(1582, 10, 5)).day() == 15);
+	static_assert(convert<Hebrew>(Islamic(1445, 8, 20)).month() == Adar);
+	static_assert(convert<Islamic>(Hebrew(5784, 12, 21, 18, 0, 0)).day() == 20);
+
+	// Fields of any calendar date, for comparison across calendars.
+	struct Fields {
+		year_t year;
+		month_t month;
+		day_t day;
+		hour_t hour;
+		minute_t minute;
+		second_t second;
+		bool operator==(Fields const&) const = default;
+	};
+
+	template <Calendar C>
+	Fields fields(C const& date) {
+		return { date.year(), date.month(), date.day(), date.hour(), date.minute(), date.second() };
+	}
+
+	// The reference conversion: encode to a Jd, decode with the target's jd_to_ function.
+	template <Calendar To, Calendar From>
+	Fields via_jd(From const& from) {
+		jd_t const jd = static_cast<Jd>(from).jd();
+		Fields f{};
+		if constexpr (std::is_same_v<To, Gregorian>) jd_to_gregorian(jd, f.year, f.month, f.day, f.hour, f.minute, f.second);
+		if constexpr (std::is_same_v<To, Julian>) jd_to_julian(jd, f.year, f.month, f.day, f.hour, f.minute, f.second);
+		if constexpr (std::is_same_v<To, Islamic>) jd_to_islamic(jd, f.year, f.month, f.day, f.hour, f.minute, f.second);
+		if constexpr (std::is_same_v<To, Hebrew>) jd_to_hebrew(jd, f.year, f.month, f.day, f.hour, f.minute, f.second);
+		return f;
+	}
+
+	// Random Gregorian dates and whole-second times of day from 3000 BCE to 3000 CE.
+	vector<Gregorian> const& random_dates() {
+		static vector<Gregorian> const dates = [] {
+			mt19937_64 rng(150);
+			uniform_int_distribution<jdn_t> day(625'000, 2'817'000);
+			uniform_int_distribution<int> second(0, 86'399);
+			vector<Gregorian> v;
+			for (int i = 0; i < 4096; ++i) {
+				year_t y;
+				month_t m;
+				day_t d;
+				jdn_to_gregorian(day(rng), y, m, d);
+				int const s = second(rng);
+				v.emplace_back(y, m, d, s / 3600, s / 60 % 60, s % 60);
+			}
+			return v;
+		}();
+		return dates;
+	}
+
+	// Converts from Gregorian to From, then checks convert<To> against the Jd path.
+	template <Calendar From, Calendar To>
+	bool agrees_with_jd(Gregorian const& g) {
+		From const from = convert<From>(g);
+		return fields(convert<To>(from)) == via_jd<To>(from);
+	}
+}
+
+
+
+/**	Gregorian and Julian convert directly through their day numbers. */
+GATS_TEST_CASE(ut150_test_convert_gregorian_julian, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_150
+	using namespace khronos;
+
+	GATS_CHECK(fields(convert<Julian>(Gregorian(1582, 10, 15))) == (Fields{ 1582, 10, 5, 0, 0, 0 }));
+	GATS_CHECK(fields(convert<Julian>(Gregorian(2024, 3, 1, 23, 59, 59.75))) == (Fields{ 2024, 2, 17, 23, 59, 59.75 }));
+	GATS_CHECK(fields(convert<Gregorian>(Julian(-44, 3, 15))) == (Fields{ -44, 3, 13, 0, 0, 0 }));
+	GATS_CHECK(fields(convert<Gregorian>(Julian(1900, 2, 29))) == (Fields{ 1900, 3, 13, 0, 0, 0 }));
+
+	for (auto const& g : random_dates()) {
+		GATS_CHECK((agrees_with_jd<Gregorian, Julian>(g)));
+		GATS_CHECK((agrees_with_jd<Julian, Gregorian>(g)));
+		GATS_CHECK(fields(convert<Gregorian>(convert<Julian>(g))) == fields(g));
+	}
+#endif
+}
+
+
+
+/**	Every other pair agrees with the conversion through a Jd, including the noon day boundary. */
+GATS_TEST_CASE(ut151_test_convert_all_pairs, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_151
+	using namespace khronos;
+
+	// The Islamic and Hebrew days turn over at noon.
+	GATS_CHECK(fields(convert<Islamic>(Gregorian(2024, 3, 1, 11, 59, 59))) == (Fields{ 1445, 8, 20, 11, 59, 59 }));
+	GATS_CHECK(fields(convert<Islamic>(Gregorian(2024, 3, 1, 12, 0, 0))) == (Fields{ 1445, 8, 21, 12, 0, 0 }));
+	GATS_CHECK(fields(convert<Gregorian>(Hebrew(5784, 12, 22, 18, 0, 0))) == (Fields{ 2024, 3, 1, 18, 0, 0 }));
+
+	for (auto const& g : random_dates()) {
+		GATS_CHECK((agrees_with_jd<Gregorian, Islamic>(g)));
+		GATS_CHECK((agrees_with_jd<Gregorian, Hebrew>(g)));
+		GATS_CHECK((agrees_with_jd<Julian, Islamic>(g)));
+		GATS_CHECK((agrees_with_jd<Julian, Hebrew>(g)));
+		GATS_CHECK((agrees_with_jd<Islamic, Gregorian>(g)));
+		GATS_CHECK((agrees_with_jd<Islamic, Julian>(g)));
+		GATS_CHECK((agrees_with_jd<Islamic, Hebrew>(g)));
+		GATS_CHECK((agrees_with_jd<Hebrew, Gregorian>(g)));
+		GATS_CHECK((agrees_with_jd<Hebrew, Julian>(g)));
+		GATS_CHECK((agrees_with_jd<Hebrew, Islamic>(g)));
+	}
+#endif
+}
+
+
+
+/**	The batch overload matches the single-date conversion. */
+GATS_TEST_CASE(ut152_test_convert_batch, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_152
+	using namespace khronos;
+
+	auto const& dates = random_dates();
+	vector<Hebrew> hebrew(dates.size(), Hebrew(1, 1, 1));
+	convert(span<Gregorian const>(dates), span<Hebrew>(hebrew));
+	vector<Julian> julian(dates.size(), Julian(1, 1, 1));
+	convert(span<Hebrew const>(hebrew), span<Julian>(julian));
+
+	for (size_t i = 0; i < dates.size(); ++i) {
+		GATS_CHECK(fields(hebrew[i]) == fields(convert<Hebrew>(dates[i])));
+		GATS_CHECK(fields(julian[i]) == fields(convert<Julian>(dates[i])));
+	}
+#endif
+}
+
+
+
+/**	Gregorian to Julian without the Jd round trip. */
+GATS_BENCHMARK(ut153_bench_convert_gregorian_julian, MIXED_CALENDAR_GROUP) {
+#if PHASE_153
+	using namespace khronos;
+
+	static size_t i = 0;
+	i = (i + 1) & 4095;
+	Gregorian g = random_dates()[i];
+	gats::do_not_optimize(g);
+
+	Julian j = convert<Julian>(g);
+	gats::do_not_optimize(j);
+#endif
+}
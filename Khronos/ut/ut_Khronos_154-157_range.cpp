@@ -0,0 +1,191 @@
+/*	ut_Khronos_154-157_range.cpp
+
+	Khronos library lazy date range unit test and benchmark.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <algorithm>
+#include <ranges>
+using namespace std;
+
+
+
+namespace {
+	using namespace khronos;
+
+	static_assert(std::ranges::random_access_range<DateRange<Gregorian>>);
+	static_assert(std::ranges::sized_range<DateRange<Hebrew>>);
+	static_assert(std::ranges::view<DateRange<Islamic>>);
+	static_assert(std::ranges::borrowed_range<DateRange<Julian>>);
+	static_assert(range(Gregorian(2024, 2, 1), Gregorian(2024, 3, 1)).size() == 29);
+	static_assert(range(Gregorian(2024, 1, 1), Gregorian(2025, 1, 1), 7).size() == 53);
+	static_assert(range(Gregorian(2024, 3, 1), Gregorian(2024, 2, 1), -1).size() == 29);
+	static_assert(range(Gregorian(2024, 3, 1), Gregorian(2024, 2, 1)).empty());
+	static_assert(range(Hebrew(5784, 12, 1), Hebrew(5784, 1, 1))[30].month() == Veadar);
+
+	// True if the iterator's date is the date decoded from its day number.
+	template <SteppableCalendar C>
+	bool matches_decoded(C const& date, jdn_t jdn) {
+		year_t y;
+		month_t m;
+		day_t d;
+		calendar_traits<C>::from_jdn(jdn, y, m, d);
+		return date.year() == y && date.month() == m && date.day() == d;
+	}
+
+	// Walks a range forwards and backwards, checking every date against a full decode.
+	template <SteppableCalendar C>
+	bool walk_agrees(C const& first, C const& last, std::int64_t step) {
+		auto const r = range(first, last, step);
+		bool ok = true;
+		jdn_t expected = calendar_traits<C>::to_jdn(first.year(), first.month(), first.day());
+		size_t count = 0;
+		for (auto it = r.begin(); it != r.end(); ++it, expected += step, ++count)
+			ok = ok && it.jdn() == expected && matches_decoded(*it, expected);
+		ok = ok && count == r.size();
+		for (auto it = r.end(); it != r.begin();) {
+			--it;
+			expected -= step;
+			ok = ok && it.jdn() == expected && matches_decoded(*it, expected);
+		}
+		return ok;
+	}
+}
+
+
+
+/**	Daily walks match a full decode in every calendar. */
+GATS_TEST_CASE(ut154_test_range_daily, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_154
+	using namespace khronos;
+
+	GATS_CHECK(walk_agrees(Gregorian(1899, 1, 1), Gregorian(2101, 1, 1), 1));
+	GATS_CHECK(walk_agrees(Gregorian(-401, 1, 1), Gregorian(-399, 1, 1), 1));
+	GATS_CHECK(walk_agrees(Julian(1896, 1, 1), Julian(1905, 1, 1), 1));
+	GATS_CHECK(walk_agrees(Islamic(1400, 1, 1), Islamic(1431, 1, 1), 1));
+	GATS_CHECK(walk_agrees(Islamic(-31, 1, 1), Islamic(31, 1, 1), 1));
+	GATS_CHECK(walk_agrees(Hebrew(5760, 7, 1), Hebrew(5800, 7, 1), 1));
+
+	// The time of day of the first date is carried to every date.
+	auto const r = range(Gregorian(2024, 2, 28, 18, 30, 0), Gregorian(2024, 3, 2));
+	GATS_CHECK_EQUAL(r.size(), 3u);
+	GATS_CHECK_EQUAL(r[1].day(), 29);
+	GATS_CHECK_EQUAL(r[2].month(), 3);
+	GATS_CHECK_EQUAL(r[2].hour(), 18);
+	GATS_CHECK_EQUAL(r[2].minute(), 30);
+
+	// Across the Islamic era every produced date exists: it round-trips through its Julian Day.
+	bool islamicExists = true;
+	for (Islamic const& date : range(Islamic(-3, 1, 1), Islamic(3, 1, 1))) {
+		year_t y;
+		month_t m;
+		day_t d;
+		jd_to_islamic(date.to_jd(), y, m, d);
+		islamicExists = islamicExists && y == date.year() && m == date.month() && d == date.day();
+	}
+	GATS_CHECK(islamicExists);
+	GATS_CHECK_EQUAL(range(Islamic(-3, 1, 1), Islamic(3, 1, 1)).size(), static_cast<size_t>(islamic_to_jdn(3, 1, 1) - islamic_to_jdn(-3, 1, 1)));
+#endif
+}
+
+
+
+/**	Longer and negative steps, and random-access jumps. */
+GATS_TEST_CASE(ut155_test_range_steps, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_155
+	using namespace khronos;
+
+	for (std::int64_t step : { 2, 7, 30, 31, 62, 63, 100, 365, -1, -7, -45, -400 }) {
+		GATS_CHECK_MESSAGE(walk_agrees(Gregorian(1990, 1, 1), Gregorian(2010, 1, 1), step) || step < 0, "step " << step);
+		GATS_CHECK_MESSAGE(walk_agrees(Gregorian(2010, 1, 1), Gregorian(1990, 1, 1), step) || step > 0, "step " << step);
+		GATS_CHECK_MESSAGE(walk_agrees(Hebrew(5750, 7, 1), Hebrew(5770, 7, 1), step) || step < 0, "step " << step);
+		GATS_CHECK_MESSAGE(walk_agrees(Islamic(1430, 1, 1), Islamic(1410, 1, 1), step) || step > 0, "step " << step);
+	}
+
+	auto const r = range(Gregorian(2000, 1, 1), Gregorian(2100, 1, 1));
+	auto it = r.begin();
+	it += 366;
+	GATS_CHECK_EQUAL((*it).year(), 2001);
+	GATS_CHECK_EQUAL((*it).day(), 1);
+	it -= 1;
+	GATS_CHECK_EQUAL((*it).day(), 31);
+	GATS_CHECK_EQUAL(r.end() - r.begin(), 36'525);
+	GATS_CHECK(r.begin() < it && it < r.end());
+
+	// Works with the standard range algorithms.
+	auto const firsts = std::ranges::count_if(r, [](Gregorian const& g) { return g.day() == 1; });
+	GATS_CHECK_EQUAL(firsts, 1'200);
+	auto const leap = std::ranges::find_if(r, [](Gregorian const& g) { return g.month() == 2 && g.day() == 29; });
+	GATS_CHECK_EQUAL((*leap).year(), 2000);
+	auto const bounded = std::ranges::lower_bound(r, 2'451'604, {}, [](Gregorian const& g) { return gregorian_to_jdn(g.year(), g.month(), g.day()); });
+	GATS_CHECK_EQUAL((*bounded).month(), 2);
+	GATS_CHECK_EQUAL((*bounded).day(), 29);
+#endif
+}
+
+
+
+/**	Month rollover follows each calendar's month order and lengths. */
+GATS_TEST_CASE(ut156_test_range_month_order, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_156
+	using namespace khronos;
+
+	// A leap Hebrew year: Adar (30 days) then Veadar (29), then Nisan.
+	auto const leap = range(Hebrew(5784, Adar, 30), Hebrew(5784, Nisan, 2));
+	GATS_CHECK_EQUAL(leap.size(), 31u);
+	GATS_CHECK_EQUAL(leap[1].month(), Veadar);
+	GATS_CHECK_EQUAL(leap[30].month(), Nisan);
+
+	// A common year: Adar (29 days) then Nisan.
+	auto const common = range(Hebrew(5785, Adar, 29), Hebrew(5785, Nisan, 2));
+	GATS_CHECK_EQUAL(common.size(), 2u);
+	GATS_CHECK_EQUAL(common[1].month(), Nisan);
+
+	// The Hebrew year number advances at Tishri, the Islamic one at Muharram.
+	auto const newYear = range(Hebrew(5784, Elul, 29), Hebrew(5785, Tishri, 2));
+	GATS_CHECK_EQUAL(newYear[1].year(), 5785);
+	GATS_CHECK_EQUAL(newYear[1].month(), Tishri);
+	auto const hijri = range(Islamic(1445, 12, 29), Islamic(1446, 1, 2));
+	GATS_CHECK_EQUAL(hijri.size(), 3u);
+	GATS_CHECK_EQUAL(hijri[2].year(), 1446);
+	GATS_CHECK_EQUAL(hijri[2].month(), 1);
+#endif
+}
+
+
+
+/**	Walking a range costs a few operations per day. */
+GATS_BENCHMARK(ut157_bench_range_daily, MIXED_CALENDAR_GROUP) {
+#if PHASE_157
+	using namespace khronos;
+
+	static auto const r = range(Hebrew(5000, 7, 1), Hebrew(6000, 7, 1));
+	static auto it = r.begin();
+	if (++it == r.end())
+		it = r.begin();
+	Hebrew h = *it;
+	gats::do_not_optimize(h);
+#endif
+}
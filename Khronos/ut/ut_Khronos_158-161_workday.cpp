@@ -0,0 +1,202 @@
+/*	ut_Khronos_158-161_workday.cpp
+
+	Khronos library business-day calendar unit test and benchmark.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <random>
+#include <set>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	using namespace khronos;
+
+	static_assert(weekday_of_jdn(2'451'545) == Saturday);	// 2000-01-01
+	static_assert(weekday_of_jdn(0) == Monday);
+	static_assert(weekday_of_jdn(-1) == Sunday);
+
+	// Random holidays from 1990 to 2030, some of them on weekends.
+	vector<Jd> const& random_holidays() {
+		static vector<Jd> const holidays = [] {
+			mt19937_64 rng(158);
+			uniform_int_distribution<jdn_t> day(2'447'893, 2'462'503);
+			vector<Jd> v;
+			for (int i = 0; i < 600; ++i)
+				v.push_back(Jd(day(rng) - 0.5));
+			return v;
+		}();
+		return holidays;
+	}
+
+	// Day-by-day reference implementation.
+	struct Reference {
+		WeekendMask weekend;
+		set<jdn_t> holidays;
+
+		Reference(WeekendMask w, vector<Jd> const& h) : weekend(w) {
+			for (Jd const& jd : h)
+				holidays.insert(static_cast<jdn_t>(floor(jd.jd() + 0.5)));
+		}
+
+		bool workday(jdn_t jdn) const { return !(weekend >> weekday_of_jdn(jdn) & 1) && !holidays.count(jdn); }
+
+		int64_t count(jdn_t first, jdn_t last) const {
+			int64_t n = 0;
+			for (jdn_t d = first; d < last; ++d)
+				n += workday(d);
+			for (jdn_t d = last; d < first; ++d)
+				n -= workday(d);
+			return n;
+		}
+
+		jdn_t add(jdn_t day, int64_t n) const {
+			for (; n > 0; n -= workday(day))
+				++day;
+			for (; n < 0; n += workday(day))
+				--day;
+			return day;
+		}
+	};
+
+	jdn_t day_of(Jd jd) { return static_cast<jdn_t>(floor(jd.jd() + 0.5)); }
+}
+
+
+
+/**	Business days between two dates, with and without holidays. */
+GATS_TEST_CASE(ut158_test_workday_count, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_158
+	using namespace khronos;
+
+	WorkdayCalendar const plain;
+	GATS_CHECK_EQUAL(plain.count(Jd(gregorian_to_jd(2024, 3, 1)), Jd(gregorian_to_jd(2024, 4, 1))), 21);
+	GATS_CHECK_EQUAL(plain.count(Jd(gregorian_to_jd(2024, 4, 1)), Jd(gregorian_to_jd(2024, 3, 1))), -21);
+	GATS_CHECK(!plain.is_workday(Jd(gregorian_to_jd(2024, 3, 2, 15, 0, 0))));
+	GATS_CHECK(plain.is_workday(Jd(gregorian_to_jd(2024, 3, 4))));
+
+	mt19937_64 rng(1581);
+	uniform_int_distribution<jdn_t> day(2'447'000, 2'463'500);
+	uniform_int_distribution<int> length(-400, 400);
+	for (WeekendMask mask : { WEEKEND_SATURDAY_SUNDAY, WEEKEND_FRIDAY_SATURDAY, WEEKEND_SUNDAY }) {
+		WorkdayCalendar const calendar(mask, random_holidays());
+		Reference const reference(mask, random_holidays());
+		for (int i = 0; i < 2000; ++i) {
+			jdn_t const first = day(rng);
+			jdn_t const last = first + length(rng);
+			GATS_CHECK_MESSAGE(calendar.count(Jd(first - 0.5), Jd(last + 0.25)) == reference.count(first, last), first << " .. " << last);
+			GATS_CHECK(calendar.is_workday(Jd(first)) == reference.workday(day_of(Jd(first))));
+		}
+	}
+#endif
+}
+
+
+
+/**	Adding and subtracting business days, with and without holidays. */
+GATS_TEST_CASE(ut159_test_workday_add, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_159
+	using namespace khronos;
+
+	// Friday + 1 business day is Monday, at the same time of day.
+	WorkdayCalendar const plain;
+	Jd const friday(gregorian_to_jd(2024, 3, 1, 9, 30, 0));
+	GATS_CHECK_EQUAL(plain.add(friday, 1).jd(), gregorian_to_jd(2024, 3, 4, 9, 30, 0));
+	GATS_CHECK_EQUAL(plain.subtract(friday, 5).jd(), gregorian_to_jd(2024, 2, 23, 9, 30, 0));
+	GATS_CHECK_EQUAL(plain.add(friday, 0).jd(), friday.jd());
+
+	// Fri/Sat weekend: Thursday + 1 business day is Sunday.
+	WorkdayCalendar const hijri(WEEKEND_FRIDAY_SATURDAY);
+	GATS_CHECK_EQUAL(hijri.add(Jd(gregorian_to_jd(2024, 2, 29)), 1).jd(), gregorian_to_jd(2024, 3, 3));
+
+	mt19937_64 rng(1591);
+	uniform_int_distribution<jdn_t> day(2'447'000, 2'463'500);
+	uniform_int_distribution<int> offset(-500, 500);
+	for (WeekendMask mask : { WEEKEND_SATURDAY_SUNDAY, WEEKEND_FRIDAY_SATURDAY, WEEKEND_SUNDAY }) {
+		WorkdayCalendar const calendar(mask, random_holidays());
+		Reference const reference(mask, random_holidays());
+		for (int i = 0; i < 2000; ++i) {
+			jdn_t const start = day(rng);
+			int const n = offset(rng);
+			Jd const result = calendar.add(Jd(start - 0.25), n);
+			GATS_CHECK_MESSAGE(day_of(result) == reference.add(start, n), start << " + " << n);
+			GATS_CHECK(result.jd() - (start - 0.25) == static_cast<jd_t>(day_of(result) - start));
+			if (n > 0)
+				GATS_CHECK(calendar.count(Jd(start + 0.5), Jd(day_of(result) + 0.5)) == n);
+			if (n < 0)
+				GATS_CHECK(calendar.count(Jd(day_of(result)), Jd(start)) == -n);
+		}
+	}
+#endif
+}
+
+
+
+/**	The batch forms match the single-date calls. */
+GATS_TEST_CASE(ut160_test_workday_batch, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_160
+	using namespace khronos;
+
+	WorkdayCalendar const calendar(WEEKEND_SATURDAY_SUNDAY, random_holidays());
+	mt19937_64 rng(160);
+	uniform_int_distribution<jdn_t> day(2'447'000, 2'463'500);
+	uniform_int_distribution<int64_t> offset(-100, 100);
+
+	vector<Jd> first, last, out(4096);
+	vector<int64_t> n, counts(4096);
+	for (size_t i = 0; i < 4096; ++i) {
+		first.push_back(Jd(day(rng) + 0.1));
+		last.push_back(Jd(day(rng) + 0.1));
+		n.push_back(offset(rng));
+	}
+	calendar.count(first, last, counts);
+	calendar.add(first, n, out);
+	for (size_t i = 0; i < 4096; ++i) {
+		GATS_CHECK(counts[i] == calendar.count(first[i], last[i]));
+		GATS_CHECK(out[i].jd() == calendar.add(first[i], n[i]).jd());
+	}
+#endif
+}
+
+
+
+/**	Counting business days costs the same for any interval length. */
+GATS_BENCHMARK(ut161_bench_workday_count, MIXED_CALENDAR_GROUP) {
+#if PHASE_161
+	using namespace khronos;
+
+	static WorkdayCalendar const calendar(WEEKEND_SATURDAY_SUNDAY, random_holidays());
+	static jdn_t first = 2'447'000;
+	first = first < 2'463'000 ? first + 37 : 2'447'000;
+	Jd a(first), b(first + 3'000.5);
+	gats::do_not_optimize(a);
+	gats::do_not_optimize(b);
+
+	int64_t n = calendar.count(a, b);
+	gats::do_not_optimize(n);
+#endif
+}
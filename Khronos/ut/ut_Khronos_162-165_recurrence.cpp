@@ -0,0 +1,282 @@
+/*	ut_Khronos_162-165_recurrence.cpp
+
+	Khronos library recurrence rule unit test and benchmark.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <cassert>
+#include <string>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	using namespace khronos;
+
+	// Compiles a rule that is known to be valid.
+	RecurrenceRule rrule(string_view text) {
+		RecurrenceRule rule;
+		ParseError const error = parse_rrule(text, rule);
+		(void)error;
+		assert(error == ParseError::none);
+		return rule;
+	}
+
+	// The first n occurrences of a rule, lazily.
+	template <SteppableCalendar C>
+	vector<C> first_n(string_view text, C const& start, size_t n) {
+		vector<C> out;
+		Recurrence<C> const recurrence(rrule(text), start);
+		for (auto it = recurrence.begin(); it != recurrence.end() && out.size() < n; ++it)
+			out.push_back(*it);
+		return out;
+	}
+
+	bool same_date(Gregorian const& date, year_t y, month_t m, day_t d) {
+		return date.year() == y && date.month() == m && date.day() == d;
+	}
+
+	// A day of a reference walk.
+	struct Day {
+		jdn_t	jdn;
+		day_t	day;
+		day_t	length;		// days in the month
+		int		weekday;
+	};
+	using Predicate = bool (*)(Day const&, jdn_t start);
+
+	// A rule and a predicate that selects the same days.
+	struct ReferenceRule {
+		char const* text;
+		Predicate	matches;
+	};
+
+	ReferenceRule const reference_rules[] = {
+		{ "FREQ=MONTHLY;BYDAY=2TU", [](Day const& d, jdn_t) { return d.weekday == Tuesday && (d.day - 1) / 7 == 1; } },
+		{ "FREQ=MONTHLY;BYDAY=-1FR", [](Day const& d, jdn_t) { return d.weekday == Friday && d.length - d.day < 7; } },
+		{ "FREQ=MONTHLY;BYMONTHDAY=30;SKIP=BACKWARD", [](Day const& d, jdn_t) { return d.day == min<day_t>(30, d.length); } },
+		{ "FREQ=MONTHLY;BYMONTHDAY=-1", [](Day const& d, jdn_t) { return d.day == d.length; } },
+		{ "FREQ=MONTHLY;BYMONTHDAY=1,15;BYDAY=SA,SU", [](Day const& d, jdn_t) { return (d.day == 1 || d.day == 15) && d.weekday >= Saturday; } },
+		{ "FREQ=MONTHLY;BYDAY=MO,TU,WE,TH,FR;BYSETPOS=-1", [](Day const& d, jdn_t) {
+			int const lastWeekday = (d.weekday + d.length - d.day) % 7;
+			day_t const back = lastWeekday == Saturday ? 1 : lastWeekday == Sunday ? 2 : 0;
+			return d.day == d.length - back; } },
+		{ "FREQ=WEEKLY;INTERVAL=2;BYDAY=MO,TH", [](Day const& d, jdn_t start) {
+			jdn_t const week0 = start - weekday_of_jdn(start);
+			return (d.weekday == Monday || d.weekday == Thursday) && (d.jdn - week0) / 7 % 2 == 0; } },
+		{ "FREQ=DAILY;INTERVAL=3;BYDAY=SU", [](Day const& d, jdn_t start) { return d.weekday == Sunday && (d.jdn - start) % 3 == 0; } },
+	};
+
+	// Expands every reference rule over [start, last) and compares with a day-by-day evaluation.
+	template <SteppableCalendar C>
+	bool agrees_with_reference(C const& start, C const& last) {
+		using traits = calendar_traits<C>;
+		jdn_t const startJdn = traits::to_jdn(start.year(), start.month(), start.day());
+		jdn_t const lastJdn = traits::to_jdn(last.year(), last.month(), last.day());
+		bool ok = true;
+		for (ReferenceRule const& reference : reference_rules) {
+			Recurrence<C> const recurrence(rrule(reference.text), start);
+			vector<jdn_t> days(2'000);
+			size_t const n = recurrence.expand(lastJdn - 1, std::span<jdn_t>(days));
+
+			size_t i = 0;
+			auto const walk = range(start, last);
+			for (auto it = walk.begin(); it != walk.end(); ++it) {
+				C const date = *it;
+				Day const day{ it.jdn(), date.day(), traits::days_in_month(date.year(), date.month()), weekday_of_jdn(it.jdn()) };
+				if (reference.matches(day, startJdn)) {
+					ok = ok && i < n && days[i] == day.jdn;
+					++i;
+				}
+			}
+			ok = ok && i == n && n > 0;
+		}
+		return ok;
+	}
+}
+
+
+
+/**	Rule parsing: accepted forms, syntax errors and unsupported or contradictory rules. */
+GATS_TEST_CASE(ut162_test_recurrence_parse, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_162
+	using namespace khronos;
+
+	RecurrenceRule rule;
+	GATS_CHECK(parse_rrule("RRULE:freq=monthly;interval=2;byday=2tu,-1FR;wkst=SU;count=10", rule) == ParseError::none);
+	GATS_CHECK(rule.frequency == RecurrenceRule::Frequency::monthly);
+	GATS_CHECK(rule.interval == 2);
+	GATS_CHECK(rule.count == 10);
+	GATS_CHECK(rule.weekStart == Sunday);
+	GATS_CHECK(rule.byDay.size() == 2);
+	GATS_CHECK(rule.byDay[0].ordinal == 2 && rule.byDay[0].weekday == Tuesday);
+	GATS_CHECK(rule.byDay[1].ordinal == -1 && rule.byDay[1].weekday == Friday);
+
+	GATS_CHECK(parse_rrule("FREQ=YEARLY;BYMONTH=1,13;BYMONTHDAY=-1,+15;BYSETPOS=1;SKIP=FORWARD;RSCALE=HEBREW;UNTIL=20301231T235959Z", rule) == ParseError::none);
+	GATS_CHECK(rule.byMonth == (1 << 1 | 1 << 13));
+	GATS_CHECK(rule.byMonthDay == vector<int>({ -1, 15 }));
+	GATS_CHECK(rule.bySetPos == vector<int>({ 1 }));
+	GATS_CHECK(rule.skip == RecurrenceRule::Skip::forward);
+	GATS_CHECK(rule.until == gregorian_to_jdn(2030, 12, 31));
+
+	GATS_CHECK(parse_rrule("", rule) == ParseError::syntax);
+	GATS_CHECK(parse_rrule("INTERVAL=2", rule) == ParseError::syntax);
+	GATS_CHECK(parse_rrule("FREQ=FORTNIGHTLY", rule) == ParseError::syntax);
+	GATS_CHECK(parse_rrule("FREQ=DAILY;FREQ=DAILY", rule) == ParseError::syntax);
+	GATS_CHECK(parse_rrule("FREQ=DAILY;COLOR=RED", rule) == ParseError::syntax);
+	GATS_CHECK(parse_rrule("FREQ=DAILY;COUNT", rule) == ParseError::syntax);
+	GATS_CHECK(parse_rrule("FREQ=MONTHLY;BYMONTHDAY=32", rule) == ParseError::syntax);
+	GATS_CHECK(parse_rrule("FREQ=MONTHLY;BYMONTHDAY=0", rule) == ParseError::syntax);
+	GATS_CHECK(parse_rrule("FREQ=MONTHLY;BYDAY=2XX", rule) == ParseError::syntax);
+	GATS_CHECK(parse_rrule("FREQ=MONTHLY;BYDAY=,MO", rule) == ParseError::syntax);
+	GATS_CHECK(parse_rrule("FREQ=DAILY;UNTIL=20240230", rule) == ParseError::syntax);
+
+	GATS_CHECK(parse_rrule("FREQ=HOURLY", rule) == ParseError::invalid_rule);
+	GATS_CHECK(parse_rrule("FREQ=YEARLY;BYWEEKNO=20", rule) == ParseError::invalid_rule);
+	GATS_CHECK(parse_rrule("FREQ=DAILY;INTERVAL=0", rule) == ParseError::invalid_rule);
+	GATS_CHECK(parse_rrule("FREQ=DAILY;COUNT=2;UNTIL=20240101", rule) == ParseError::invalid_rule);
+	GATS_CHECK(parse_rrule("FREQ=WEEKLY;BYMONTHDAY=1", rule) == ParseError::invalid_rule);
+	GATS_CHECK(parse_rrule("FREQ=DAILY;BYDAY=1MO", rule) == ParseError::invalid_rule);
+	GATS_CHECK(parse_rrule("FREQ=MONTHLY;BYSETPOS=1", rule) == ParseError::invalid_rule);
+	GATS_CHECK(string(parse_error_name(ParseError::invalid_rule)) == "invalid rule");
+#endif
+}
+
+
+
+/**	Gregorian expansions of common rules. */
+GATS_TEST_CASE(ut163_test_recurrence_gregorian, GREGORIAN_CALENDAR_GROUP, 1) {
+#if PHASE_163
+	using namespace khronos;
+
+	// Every 2nd Tuesday, carrying the start's time of day.
+	auto dates = first_n("FREQ=MONTHLY;BYDAY=2TU", Gregorian(2024, 1, 1, 9, 30, 0), 3);
+	GATS_CHECK(dates.size() == 3);
+	GATS_CHECK(same_date(dates[0], 2024, 1, 9) && same_date(dates[1], 2024, 2, 13) && same_date(dates[2], 2024, 3, 12));
+	GATS_CHECK(dates[2].hour() == 9 && dates[2].minute() == 30);
+
+	// Monthly on the 30th: omitted, clamped back or moved forward in February.
+	dates = first_n("FREQ=MONTHLY;BYMONTHDAY=30", Gregorian(2024, 1, 30), 3);
+	GATS_CHECK(same_date(dates[0], 2024, 1, 30) && same_date(dates[1], 2024, 3, 30) && same_date(dates[2], 2024, 4, 30));
+	dates = first_n("FREQ=MONTHLY;BYMONTHDAY=30;SKIP=BACKWARD", Gregorian(2024, 1, 30), 3);
+	GATS_CHECK(same_date(dates[0], 2024, 1, 30) && same_date(dates[1], 2024, 2, 29) && same_date(dates[2], 2024, 3, 30));
+	dates = first_n("FREQ=MONTHLY;SKIP=FORWARD", Gregorian(2024, 1, 30), 3);
+	GATS_CHECK(same_date(dates[0], 2024, 1, 30) && same_date(dates[1], 2024, 3, 1) && same_date(dates[2], 2024, 3, 30));
+
+	// Yearly from a leap day.
+	dates = first_n("FREQ=YEARLY", Gregorian(2024, 2, 29), 2);
+	GATS_CHECK(same_date(dates[0], 2024, 2, 29) && same_date(dates[1], 2028, 2, 29));
+	dates = first_n("FREQ=YEARLY;SKIP=BACKWARD", Gregorian(2024, 2, 29), 2);
+	GATS_CHECK(same_date(dates[0], 2024, 2, 29) && same_date(dates[1], 2025, 2, 28));
+
+	// U.S. Thanksgiving; the 20th Monday of the year.
+	dates = first_n("FREQ=YEARLY;BYMONTH=11;BYDAY=4TH", Gregorian(2020, 1, 1), 3);
+	GATS_CHECK(same_date(dates[0], 2020, 11, 26) && same_date(dates[1], 2021, 11, 25) && same_date(dates[2], 2022, 11, 24));
+	dates = first_n("FREQ=YEARLY;BYDAY=20MO", Gregorian(2024, 1, 1), 1);
+	GATS_CHECK(same_date(dates[0], 2024, 5, 13));
+
+	// Every other week on Monday and Friday, four times.
+	dates = first_n("FREQ=WEEKLY;INTERVAL=2;BYDAY=MO,FR;COUNT=4", Gregorian(2024, 1, 1), 10);
+	GATS_CHECK(dates.size() == 4);
+	GATS_CHECK(same_date(dates[0], 2024, 1, 1) && same_date(dates[1], 2024, 1, 5) && same_date(dates[2], 2024, 1, 15) && same_date(dates[3], 2024, 1, 19));
+
+	// Last working day of the month.
+	dates = first_n("FREQ=MONTHLY;BYDAY=MO,TU,WE,TH,FR;BYSETPOS=-1", Gregorian(2024, 3, 1), 3);
+	GATS_CHECK(same_date(dates[0], 2024, 3, 29) && same_date(dates[1], 2024, 4, 30) && same_date(dates[2], 2024, 5, 31));
+
+	// A start date that does not match the rule is not an occurrence.
+	dates = first_n("FREQ=MONTHLY;BYDAY=-1FR", Gregorian(2024, 1, 31), 1);
+	GATS_CHECK(same_date(dates[0], 2024, 2, 23));
+
+	// UNTIL is inclusive; expand() stops at its horizon and at the end of the buffer.
+	dates = first_n("FREQ=DAILY;INTERVAL=10;UNTIL=20240131", Gregorian(2024, 1, 1), 10);
+	GATS_CHECK(dates.size() == 4 && same_date(dates[3], 2024, 1, 31));
+	Recurrence<Gregorian> const weekly(rrule("FREQ=WEEKLY"), Gregorian(2024, 1, 1));
+	vector<Gregorian> buffer(10, Gregorian(1, 1, 1));
+	GATS_CHECK(weekly.expand(Gregorian(2024, 1, 29), std::span<Gregorian>(buffer)) == 5);
+	GATS_CHECK(weekly.expand(Gregorian(2025, 1, 1), std::span<Gregorian>(buffer)) == 10);
+	vector<jdn_t> days(100);
+	GATS_CHECK(weekly.expand(gregorian_to_jdn(2024, 12, 31), std::span<jdn_t>(days)) == 53);
+	GATS_CHECK(days[52] == gregorian_to_jdn(2024, 12, 30));
+
+	// A rule that never matches ends instead of looping.
+	GATS_CHECK(first_n("FREQ=MONTHLY;BYMONTH=2;BYMONTHDAY=30", Gregorian(2024, 1, 1), 1).empty());
+#endif
+}
+
+
+
+/**	Expansions agree with a day-by-day evaluation in the Gregorian, Islamic and Hebrew calendars. */
+GATS_TEST_CASE(ut164_test_recurrence_reference, MIXED_CALENDAR_GROUP, 1) {
+#if PHASE_164
+	using namespace khronos;
+
+	GATS_CHECK(agrees_with_reference(Gregorian(2019, 5, 17), Gregorian(2039, 5, 17)));
+	GATS_CHECK(agrees_with_reference(Islamic(1440, 3, 10), Islamic(1460, 3, 10)));
+	GATS_CHECK(agrees_with_reference(Hebrew(5780, 7, 1), Hebrew(5800, 7, 1)));
+
+	// Veadar exists only in Hebrew leap years: 7 in a 19-year cycle.
+	Recurrence<Hebrew> const veadar(rrule("FREQ=YEARLY;BYMONTH=13;BYMONTHDAY=14"), Hebrew(5782, 7, 1));
+	vector<Hebrew> dates(20, Hebrew(5782, 7, 1));
+	GATS_CHECK(veadar.expand(Hebrew(5800, 6, 29), std::span<Hebrew>(dates)) == 7);
+	GATS_CHECK(dates[0].year() == 5782 && dates[0].month() == Veadar && dates[0].day() == 14);
+
+	// Yearly on Tishri 1: the year starts at Tishri, so the first period is the start's year.
+	Recurrence<Hebrew> const roshHashanah(rrule("FREQ=YEARLY;COUNT=2"), Hebrew(5784, 7, 1));
+	auto it = roshHashanah.begin();
+	GATS_CHECK((*it).year() == 5784);
+	++it;
+	GATS_CHECK((*it).year() == 5785 && (*it).month() == Tishri && (*it).day() == 1);
+	++it;
+	GATS_CHECK(it == roshHashanah.end());
+#endif
+}
+
+
+
+/**	Expands one of a set of mixed rules over a five-year horizon into a preallocated buffer. */
+GATS_BENCHMARK(ut165_bench_recurrence_expand, MIXED_CALENDAR_GROUP) {
+#if PHASE_165
+	using namespace khronos;
+
+	static vector<Recurrence<Gregorian>> const rules = [] {
+		char const* const texts[] = {
+			"FREQ=MONTHLY;BYDAY=2TU", "FREQ=MONTHLY;BYMONTHDAY=30;SKIP=BACKWARD", "FREQ=WEEKLY;BYDAY=MO,WE,FR",
+			"FREQ=MONTHLY;BYDAY=MO,TU,WE,TH,FR;BYSETPOS=-1", "FREQ=YEARLY;BYMONTH=11;BYDAY=4TH", "FREQ=DAILY;INTERVAL=3" };
+		vector<Recurrence<Gregorian>> r;
+		for (int i = 0; i < 64; ++i)
+			r.emplace_back(rrule(texts[i % size(texts)]), Gregorian(2024, 1 + i % 12, 1 + i % 28));
+		return r;
+	}();
+	static vector<jdn_t> buffer(2'000);
+	static size_t next = 0;
+	jdn_t const horizon = gregorian_to_jdn(2029, 1, 1);
+	gats::do_not_optimize(horizon);
+
+	size_t n = rules[next++ % rules.size()].expand(horizon, std::span<jdn_t>(buffer));
+	gats::do_not_optimize(n);
+#endif
+}
@@ -0,0 +1,170 @@
+/*	ut_Khronos_166-168_hebrew_holidays.cpp
+
+	Khronos library Jewish holiday unit test and benchmark.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	using namespace khronos;
+
+	// The observed Julian Day of a holiday in a list, or 0 when absent.
+	jd_t find_holiday(vector<HebrewHolidayDate> const& list, HebrewHoliday holiday, year_t year) {
+		for (HebrewHolidayDate const& h : list)
+			if (h.holiday == holiday && h.year == year)
+				return h.jd.jd();
+		return 0;
+	}
+}
+
+
+
+/**	Known dates, including the fast-day postponements and Veadar placement. */
+GATS_TEST_CASE(ut166_test_hebrew_holidays_dates, HEBREW_CALENDAR_GROUP, 1) {
+#if PHASE_166
+	using namespace khronos;
+
+	auto const list = hebrew_holidays(5782, 5785);
+	GATS_CHECK(list.size() == 4 * 22);
+	GATS_CHECK(find_holiday(list, HebrewHoliday::rosh_hashanah, 5785) == "2024-10-03"_greg);
+	GATS_CHECK(find_holiday(list, HebrewHoliday::yom_kippur, 5785) == "2024-10-12"_greg);
+	GATS_CHECK(find_holiday(list, HebrewHoliday::hanukkah, 5785) == "2024-12-26"_greg);
+	GATS_CHECK(find_holiday(list, HebrewHoliday::purim, 5785) == "2025-03-14"_greg);
+	GATS_CHECK(find_holiday(list, HebrewHoliday::pesach, 5785) == "2025-04-13"_greg);
+	GATS_CHECK(find_holiday(list, HebrewHoliday::shavuot, 5785) == "2025-06-02"_greg);
+	GATS_CHECK(find_holiday(list, HebrewHoliday::tisha_bav, 5785) == "2025-08-03"_greg);
+
+	// 3 Tishri 5785 was a Saturday; the fast moved to Sunday.
+	GATS_CHECK(find_holiday(list, HebrewHoliday::fast_of_gedaliah, 5785) == "2024-10-06"_greg);
+
+	// 5784 is a leap year: Purim is 14 Veadar, and 13 Veadar was a Saturday, so the Fast of Esther was on Thursday.
+	GATS_CHECK(find_holiday(list, HebrewHoliday::purim, 5784) == hebrew_to_jd(5784, Veadar, 14));
+	GATS_CHECK(find_holiday(list, HebrewHoliday::purim, 5784) == "2024-03-24"_greg);
+	GATS_CHECK(find_holiday(list, HebrewHoliday::fast_of_esther, 5784) == "2024-03-21"_greg);
+
+	// 17 Tammuz and 9 Av 5782 were Saturdays.
+	GATS_CHECK(find_holiday(list, HebrewHoliday::seventeenth_of_tammuz, 5782) == "2022-07-17"_greg);
+	GATS_CHECK(find_holiday(list, HebrewHoliday::tisha_bav, 5782) == "2022-08-07"_greg);
+
+	// Israel: no second festival days; Simchat Torah on Shemini Atzeret.
+	auto const israel = hebrew_holidays(5785, 5785, HolidayRegion::israel);
+	GATS_CHECK(israel.size() == 22 - 4);
+	GATS_CHECK(find_holiday(israel, HebrewHoliday::pesach_2, 5785) == 0);
+	GATS_CHECK(find_holiday(israel, HebrewHoliday::simchat_torah, 5785) == "2024-10-24"_greg);
+	GATS_CHECK(find_holiday(list, HebrewHoliday::simchat_torah, 5785) == "2024-10-25"_greg);
+
+	GATS_CHECK(hebrew_holidays(5785, 5784).empty());
+	GATS_CHECK(string(hebrew_holiday_name(HebrewHoliday::tisha_bav)) == "Tisha B'Av");
+#endif
+}
+
+
+
+/**	Across a millennium every holiday agrees with hebrew_to_jd of its date, moved only by the postponement rules. */
+GATS_TEST_CASE(ut167_test_hebrew_holidays_range, HEBREW_CALENDAR_GROUP, 1) {
+#if PHASE_167
+	using namespace khronos;
+
+	year_t const first = 5300, last = 6300;
+	for (HolidayRegion region : { HolidayRegion::diaspora, HolidayRegion::israel }) {
+		auto const list = hebrew_holidays(first, last, region);
+		GATS_CHECK(list.size() == static_cast<size_t>(last - first + 1) * (region == HolidayRegion::israel ? 18 : 22));
+		GATS_CHECK(is_sorted(list.begin(), list.end(),
+			[](HebrewHolidayDate const& a, HebrewHolidayDate const& b) { return a.jd.jd() < b.jd.jd(); }));
+
+		bool ok = true;
+		for (HebrewHolidayDate const& h : list) {
+			jd_t expected = 0;
+			jdn_t const jdn = static_cast<jdn_t>(h.jd.jd() + 0.5);
+			int const weekday = weekday_of_jdn(jdn);
+			switch (h.holiday) {
+			case HebrewHoliday::rosh_hashanah:
+				expected = hebrew_to_jd(h.year, Tishri, 1);
+				ok = ok && weekday != Sunday && weekday != Wednesday && weekday != Friday;
+				break;
+			case HebrewHoliday::fast_of_gedaliah:
+				expected = hebrew_to_jd(h.year, Tishri, 3);
+				if (expected != h.jd.jd())
+					expected += 1;
+				break;
+			case HebrewHoliday::fast_of_esther:
+				expected = hebrew_to_jd(h.year, is_hebrew_leapyear(h.year) ? Veadar : Adar, 13);
+				if (expected != h.jd.jd())
+					expected -= 2;
+				break;
+			case HebrewHoliday::purim:
+				expected = hebrew_to_jd(h.year, is_hebrew_leapyear(h.year) ? Veadar : Adar, 14);
+				break;
+			case HebrewHoliday::pesach:
+				expected = hebrew_to_jd(h.year, Nisan, 15);
+				break;
+			case HebrewHoliday::tisha_bav:
+				expected = hebrew_to_jd(h.year, Av, 9);
+				if (expected != h.jd.jd())
+					expected += 1;
+				break;
+			case HebrewHoliday::hanukkah:
+				expected = hebrew_to_jd(h.year, Kislev, 25);
+				break;
+			default:
+				expected = h.jd.jd();
+				break;
+			}
+			ok = ok && h.jd.jd() == expected;
+
+			// No fast is observed on Shabbat.
+			bool const fast = h.holiday == HebrewHoliday::fast_of_gedaliah || h.holiday == HebrewHoliday::tenth_of_tevet
+				|| h.holiday == HebrewHoliday::fast_of_esther || h.holiday == HebrewHoliday::seventeenth_of_tammuz
+				|| h.holiday == HebrewHoliday::tisha_bav;
+			ok = ok && !(fast && weekday == Saturday);
+		}
+		GATS_CHECK(ok);
+	}
+#endif
+}
+
+
+
+/**	Lists five centuries of diaspora holidays into a reused buffer. */
+GATS_BENCHMARK(ut168_bench_hebrew_holidays, HEBREW_CALENDAR_GROUP) {
+#if PHASE_168
+	using namespace khronos;
+
+	static vector<HebrewHolidayDate> list;
+	static year_t first = 5500;
+	gats::do_not_optimize(first);
+
+	list.clear();
+	hebrew_holidays(first, first + 499, HolidayRegion::diaspora, list);
+	jd_t last = list.back().jd.jd();
+	gats::do_not_optimize(last);
+#endif
+}
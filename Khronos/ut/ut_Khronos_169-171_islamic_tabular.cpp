@@ -0,0 +1,212 @@
+/*	ut_Khronos_169-171_islamic_tabular.cpp
+
+	Khronos library tabular Islamic calendar variants unit test and benchmark.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	using namespace khronos;
+
+	using IslamicAstronomical = IslamicTabular<IslamicLeap16, IslamicAstronomicalEpoch>;
+	using Islamic15 = IslamicTabular<IslamicLeap15, IslamicCivilEpoch>;
+	using Islamic15Astronomical = IslamicTabular<IslamicLeap15, IslamicAstronomicalEpoch>;
+
+	static_assert(std::is_same_v<Islamic, IslamicTabular<IslamicLeap16, IslamicCivilEpoch>>);
+	static_assert(islamic_to_jdn(1, 1, 1) == IslamicCivilEpoch::JDN);
+	static_assert(islamic_to_jdn<IslamicLeap16, IslamicAstronomicalEpoch>(1, 1, 1) == IslamicAstronomicalEpoch::JDN);
+	static_assert(is_islamic_leapyear<IslamicLeap16>(16) && !is_islamic_leapyear<IslamicLeap16>(15));
+	static_assert(is_islamic_leapyear<IslamicLeap15>(15) && !is_islamic_leapyear<IslamicLeap15>(16));
+	static_assert(Jd(IslamicAstronomical(1445, 9, 1)).jd() == Jd(Islamic(1445, 9, 1)).jd() - 1);
+
+	// Every day of a span decodes to the date that encodes back to it, and the days run on without gaps.
+	template <class LeapPattern, class Epoch>
+	bool round_trips(jdn_t first, jdn_t last) {
+		year_t py = 0;
+		month_t pm = 0;
+		day_t pd = 0;
+		jdn_to_islamic<LeapPattern, Epoch>(first - 1, py, pm, pd);
+		bool ok = true;
+		for (jdn_t jdn = first; jdn < last; ++jdn) {
+			year_t y;
+			month_t m;
+			day_t d;
+			jdn_to_islamic<LeapPattern, Epoch>(jdn, y, m, d);
+			ok = ok && islamic_to_jdn<LeapPattern, Epoch>(y, m, d) == jdn;
+			day_t const length = static_cast<day_t>(islamic_days_in_month(pm, is_islamic_leapyear<LeapPattern>(py)));
+			ok = ok && (d == pd + 1 ? m == pm && y == py : d == 1 && pd == length);
+			py = y;
+			pm = m;
+			pd = d;
+		}
+		return ok;
+	}
+}
+
+
+
+/**	Kernels of the four standard variants: epochs, leap patterns and round trips. */
+GATS_TEST_CASE(ut169_test_islamic_tabular_kernels, ISLAMIC_CALENDAR_GROUP, 1) {
+#if PHASE_169
+	using namespace khronos;
+
+	GATS_CHECK(islamic_to_jd(1445, 9, 1) == 2'460'380.5);
+	GATS_CHECK((islamic_to_jd<IslamicLeap16, IslamicAstronomicalEpoch>(1445, 9, 1)) == 2'460'379.5);
+	GATS_CHECK(weekday_of_jdn(IslamicCivilEpoch::JDN) == Friday);
+	GATS_CHECK(weekday_of_jdn(IslamicAstronomicalEpoch::JDN) == Thursday);
+
+	// The 15-type cycle inserts its day a year earlier: only year 16 of each cycle starts a day later.
+	bool shifted = true;
+	for (year_t year = -600; year <= 3000; ++year) {
+		jdn_t const difference = islamic_to_jdn<IslamicLeap15>(year, 1, 1) - islamic_to_jdn<IslamicLeap16>(year, 1, 1);
+		year_t const inCycle = ((year - 1) % 30 + 30) % 30 + 1;
+		shifted = shifted && difference == (inCycle == 16 ? 1 : 0);
+	}
+	GATS_CHECK(shifted);
+
+	// Eleven leap years in every 30-year cycle.
+	int leap15 = 0, leap16 = 0;
+	for (year_t year = 1; year <= 30; ++year) {
+		leap15 += is_islamic_leapyear<IslamicLeap15>(year);
+		leap16 += is_islamic_leapyear<IslamicLeap16>(year);
+	}
+	GATS_CHECK(leap15 == 11 && leap16 == 11);
+
+	// The leap test agrees with the kernels on both sides of the era.
+	bool leapAgrees = true;
+	for (year_t year = -1'000; year <= 1'000; ++year) {
+		leapAgrees = leapAgrees && is_islamic_leapyear<IslamicLeap16>(year) == (islamic_to_jdn<IslamicLeap16>(year + 1, 1, 1) - islamic_to_jdn<IslamicLeap16>(year, 12, 1) == 30);
+		leapAgrees = leapAgrees && is_islamic_leapyear<IslamicLeap15>(year) == (islamic_to_jdn<IslamicLeap15>(year + 1, 1, 1) - islamic_to_jdn<IslamicLeap15>(year, 12, 1) == 30);
+	}
+	GATS_CHECK(leapAgrees);
+	static_assert(!is_islamic_leapyear(-100) && is_islamic_leapyear(-1) && !is_islamic_leapyear(0));
+
+	// From 40 cycles before the era to 2700000.
+	jdn_t const first = IslamicCivilEpoch::JDN - 40 * 10'631, last = 2'700'000;
+	GATS_CHECK((round_trips<IslamicLeap16, IslamicCivilEpoch>(first, last)));
+	GATS_CHECK((round_trips<IslamicLeap16, IslamicAstronomicalEpoch>(first, last)));
+	GATS_CHECK((round_trips<IslamicLeap15, IslamicCivilEpoch>(first, last)));
+	GATS_CHECK((round_trips<IslamicLeap15, IslamicAstronomicalEpoch>(first, last)));
+#endif
+}
+
+
+
+/**	Variant classes work with the library's generic facilities and the batch kernels match the scalar ones. */
+GATS_TEST_CASE(ut170_test_islamic_tabular_class_batch, ISLAMIC_CALENDAR_GROUP, 1) {
+#if PHASE_170
+	using namespace khronos;
+
+	// The same day in two variants.
+	IslamicAstronomical const a = convert<IslamicAstronomical>(Islamic(1445, 9, 1, 9, 0, 0));
+	GATS_CHECK(a.year() == 1445 && a.month() == 9 && a.day() == 2 && a.hour() == 9);
+	GATS_CHECK(Jd(a).jd() == Jd(Islamic(1445, 9, 1, 9, 0, 0)).jd());
+	GATS_CHECK(convert<Gregorian>(Islamic15Astronomical(1445, 9, 1)).day() == 10);
+	GATS_CHECK(add_days(Islamic15(1444, 12, 29), 1) == Islamic15(1445, 1, 1));
+	GATS_CHECK(add_months(Islamic15(1446, 1, 30), 11) == Islamic15(1446, 12, 29));
+	GATS_CHECK(add_months(Islamic15(1455, 1, 30), 11) == Islamic15(1455, 12, 30));
+	GATS_CHECK(add_months(Islamic(1455, 1, 30), 11) == Islamic(1455, 12, 29));
+	GATS_CHECK(range(Islamic15(1455, 1, 1), Islamic15(1456, 1, 1)).size() == 355);
+	GATS_CHECK(range(Islamic(1455, 1, 1), Islamic(1456, 1, 1)).size() == 354);
+
+	// Batch kernels of every instantiated variant.
+	mt19937_64 rng(169);
+	uniform_int_distribution<jdn_t> pick(1'800'000, 2'700'000);
+	size_t const n = 4'096;
+	vector<jd_t> jds(n), back(n);
+	for (jd_t& jd : jds)
+		jd = static_cast<jd_t>(pick(rng)) - 0.5;
+	vector<year_t> years(n);
+	vector<month_t> months(n);
+	vector<day_t> days(n);
+
+	auto check = [&]<class LeapPattern, class Epoch>() {
+		batch::jd_to_islamic<LeapPattern, Epoch>(jds, years, months, days);
+		batch::islamic_to_jd<LeapPattern, Epoch>(years, months, days, back);
+		bool ok = back == jds;
+		for (size_t i = 0; i < n; ++i) {
+			year_t y;
+			month_t m;
+			day_t d;
+			khronos::jd_to_islamic<LeapPattern, Epoch>(jds[i], y, m, d);
+			ok = ok && y == years[i] && m == months[i] && d == days[i];
+		}
+
+		vector<year_t> outYears(n);
+		vector<month_t> outMonths(n);
+		vector<day_t> outDays(n);
+		batch::islamic_add_months<LeapPattern, Epoch>(years, months, days, 7, outYears, outMonths, outDays);
+		for (size_t i = 0; i < n; ++i) {
+			auto const shifted = add_months(IslamicTabular<LeapPattern, Epoch>(years[i], months[i], days[i]), 7);
+			ok = ok && shifted.year() == outYears[i] && shifted.month() == outMonths[i] && shifted.day() == outDays[i];
+		}
+		batch::islamic_add_days<LeapPattern, Epoch>(years, months, days, -100, outYears, outMonths, outDays);
+		for (size_t i = 0; i < n; ++i)
+			ok = ok && islamic_to_jdn<LeapPattern, Epoch>(outYears[i], outMonths[i], outDays[i]) == static_cast<jdn_t>(jds[i] + 0.5) - 100;
+		return ok;
+	};
+	GATS_CHECK((check.operator()<IslamicLeap16, IslamicCivilEpoch>()));
+	GATS_CHECK((check.operator()<IslamicLeap16, IslamicAstronomicalEpoch>()));
+	GATS_CHECK((check.operator()<IslamicLeap15, IslamicCivilEpoch>()));
+	GATS_CHECK((check.operator()<IslamicLeap15, IslamicAstronomicalEpoch>()));
+
+	// The defaults are Islamic's.
+	batch::jd_to_islamic(jds, years, months, days);
+	year_t y;
+	month_t m;
+	day_t d;
+	jd_to_islamic(jds[0], y, m, d);
+	GATS_CHECK(years[0] == y && months[0] == m && days[0] == d);
+#endif
+}
+
+
+
+/**	Decodes a column of Julian Days in the astronomical 15-type variant. */
+GATS_BENCHMARK(ut171_bench_islamic_tabular_batch, ISLAMIC_CALENDAR_GROUP) {
+#if PHASE_171
+	using namespace khronos;
+
+	static size_t const n = 1'024;
+	static vector<jd_t> const jds = [] {
+		vector<jd_t> v(n);
+		for (size_t i = 0; i < n; ++i)
+			v[i] = 2'440'000.5 + static_cast<jd_t>(i * 37);
+		return v;
+	}();
+	static vector<year_t> years(n);
+	static vector<month_t> months(n);
+	static vector<day_t> days(n);
+
+	batch::jd_to_islamic<IslamicLeap15, IslamicAstronomicalEpoch>(jds, years, months, days);
+	year_t last = years[n - 1];
+	gats::do_not_optimize(last);
+#endif
+}
@@ -0,0 +1,291 @@
+/*	ut_Khronos_172-175_ummalqura.cpp
+
+	Khronos library Umm al-Qura calendar unit test and benchmark.
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial Release
+
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+#include <khronos.hpp>
+#include "ut_Khronos.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <vector>
+using namespace std;
+
+
+
+namespace {
+	using namespace khronos;
+
+	static_assert(ummalqura_to_jdn(UMMALQURA_TABLE, 1445, 9, 1) == 2'460'381);
+
+	// A table of the first 16 years only, sharing the built-in data.
+	constexpr UmmAlQuraTable FIRST_BLOCK{ 1300, 16, span(ummalqura_data::ANCHORS).first(1), span(ummalqura_data::MONTHS).first(3) };
+	static_assert(FIRST_BLOCK.valid());
+	static_assert(FIRST_BLOCK.end_jdn() == ummalqura_data::ANCHORS[1]);
+
+	// Month starts from the CLDR/ICU calendar: 1 Muharram, 1 Rajab and the next 1 Muharram.
+	struct ReferenceYear {
+		year_t year;
+		jdn_t muharram, rajab, nextMuharram;
+	};
+	constexpr ReferenceYear REFERENCE_YEARS[] = {
+		{ 1318, 2'415'140, 2'415'318, 2'415'495 },
+		{ 1356, 2'428'607, 2'428'784, 2'428'962 },
+		{ 1420, 2'451'286, 2'451'462, 2'451'641 },
+		{ 1500, 2'479'636, 2'479'812, 2'479'990 },
+		{ 1600, 2'515'073, 2'515'249, 2'515'427 },
+	};
+
+	// Every day of a span decodes to the date that encodes back to it, and the days run on without gaps.
+	bool round_trips(jdn_t first, jdn_t last) {
+		year_t py;
+		month_t pm;
+		day_t pd;
+		jdn_to_ummalqura(first - 1, py, pm, pd);
+		bool ok = true;
+		for (jdn_t jdn = first; jdn < last; ++jdn) {
+			year_t y;
+			month_t m;
+			day_t d;
+			jdn_to_ummalqura(jdn, y, m, d);
+			ok = ok && ummalqura_to_jdn(y, m, d) == jdn;
+			ok = ok && (d == pd + 1 ? m == pm && y == py : d == 1 && pd == ummalqura_days_in_month(py, pm));
+			py = y;
+			pm = m;
+			pd = d;
+		}
+		return ok;
+	}
+
+	// A table of random month lengths with consistent anchors; pattern 0 is random, 1 all 30-day, 2 all 29-day, 3 long runs.
+	struct RandomTable {
+		year_t firstYear;
+		year_t yearCount;
+		vector<std::int32_t> anchors;
+		vector<std::uint64_t> months;
+
+		RandomTable(mt19937_64& rng, int pattern) {
+			firstYear = uniform_int_distribution<year_t>(1, 2000)(rng);
+			yearCount = uniform_int_distribution<year_t>(1, 80)(rng);
+			size_t const blocks = static_cast<size_t>((yearCount + UmmAlQuraTable::YEARS_PER_BLOCK - 1) / UmmAlQuraTable::YEARS_PER_BLOCK);
+			months.assign(blocks * UmmAlQuraTable::WORDS_PER_BLOCK, 0);
+			bool run = false;
+			for (year_t i = 0; i < yearCount * 12; ++i) {
+				if (rng() % 16 == 0)
+					run = !run;
+				bool const isLong = pattern == 0 ? rng() & 1 : pattern == 1 ? true : pattern == 2 ? false : run;
+				months[static_cast<size_t>(i / 64)] |= std::uint64_t(isLong) << (i % 64);
+			}
+			jdn_t start = islamic_to_jdn(firstYear, 1, 1);
+			for (size_t b = 0; b < blocks; ++b) {
+				anchors.push_back(static_cast<std::int32_t>(start));
+				start += 29 * UmmAlQuraTable::MONTHS_PER_BLOCK;
+				for (int w = 0; w < UmmAlQuraTable::WORDS_PER_BLOCK; ++w)
+					start += popcount(months[b * UmmAlQuraTable::WORDS_PER_BLOCK + w]);
+			}
+		}
+
+		UmmAlQuraTable table() const { return UmmAlQuraTable(firstYear, yearCount, anchors, months); }
+	};
+
+	// Every day of a table decodes to a day of its month that encodes back to it.
+	bool covers(UmmAlQuraTable const& table) {
+		bool ok = true;
+		for (jdn_t jdn = table.first_jdn(); jdn < table.end_jdn(); ++jdn) {
+			year_t y;
+			month_t m;
+			day_t d;
+			jdn_to_ummalqura(table, jdn, y, m, d);
+			ok = ok && table.contains_year(y) && m >= 1 && m <= 12 && d >= 1 && d <= ummalqura_days_in_month(table, y, m);
+			ok = ok && ummalqura_to_jdn(table, y, m, d) == jdn;
+		}
+		return ok;
+	}
+}
+
+
+
+/**	Dates of the built-in table. */
+GATS_TEST_CASE(ut172_test_ummalqura_dates, ISLAMIC_CALENDAR_GROUP, 1) {
+#if PHASE_172
+	using namespace khronos;
+
+	// Announced Saudi dates.
+	GATS_CHECK(Jd(UmmAlQura(1444, 10, 1)) == "2023-04-21"_greg);
+	GATS_CHECK(Jd(UmmAlQura(1445, 9, 1)) == "2024-03-11"_greg);
+	GATS_CHECK(Jd(UmmAlQura(1446, 1, 1)) == "2024-07-07"_greg);
+	GATS_CHECK(Jd(UmmAlQura(1446, 9, 1)) == "2025-03-01"_greg);
+	GATS_CHECK(Jd(UmmAlQura(1446, 10, 1)) == "2025-03-30"_greg);
+	GATS_CHECK(convert<UmmAlQura>(Gregorian(2025, 3, 29, 18, 0, 0)) == UmmAlQura(1446, 10, 1, 18, 0, 0));	// the day turns over at noon
+	GATS_CHECK(convert<UmmAlQura>(Islamic(1446, 1, 1)) == UmmAlQura(1446, 1, 2));
+
+	bool reference = true;
+	for (ReferenceYear const& r : REFERENCE_YEARS)
+		reference = reference && ummalqura_to_jdn(r.year, 1, 1) == r.muharram && ummalqura_to_jdn(r.year, 7, 1) == r.rajab
+			&& ummalqura_to_jdn(r.year + 1, 1, 1) == r.nextMuharram;
+	GATS_CHECK(reference);
+
+	// Outside the table the civil tabular calendar applies, and it joins the table at both ends.
+	GATS_CHECK(UMMALQURA_TABLE.first_jdn() == islamic_to_jdn(1300, 1, 1));
+	GATS_CHECK(UMMALQURA_TABLE.end_jdn() == islamic_to_jdn(1601, 1, 1));
+	GATS_CHECK(ummalqura_to_jdn(1299, 12, 29) == islamic_to_jdn(1299, 12, 29));
+	GATS_CHECK(ummalqura_to_jdn(1700, 12, 30) == islamic_to_jdn(1700, 12, 30));
+	GATS_CHECK(ummalqura_days_in_month(1, 12) == 29 && ummalqura_days_in_month(2, 12) == 30);
+
+	// Month lengths outside the table match its day numbers, before the era and at both table ends.
+	auto const lengths_match = [](year_t first, year_t last) {
+		bool ok = true;
+		for (year_t year = first; year <= last; ++year)
+			for (month_t month = 1; month <= 12; ++month) {
+				jdn_t const next = month < 12 ? ummalqura_to_jdn(UMMALQURA_TABLE, year, month + 1, 1) : ummalqura_to_jdn(UMMALQURA_TABLE, year + 1, 1, 1);
+				ok = ok && ummalqura_days_in_month(UMMALQURA_TABLE, year, month) == next - ummalqura_to_jdn(UMMALQURA_TABLE, year, month, 1);
+			}
+		return ok;
+	};
+	GATS_CHECK(lengths_match(-120, 120));
+	GATS_CHECK(lengths_match(1290, 1310));
+	GATS_CHECK(lengths_match(1590, 1610));
+
+	// Months and years.
+	bool lengths = true;
+	for (year_t year = UMMALQURA_TABLE.first_year(); year <= UMMALQURA_TABLE.last_year(); ++year) {
+		jdn_t const length = ummalqura_to_jdn(year + 1, 1, 1) - ummalqura_to_jdn(year, 1, 1);
+		lengths = lengths && (length == 354 || length == 355);
+		for (month_t month = 1; month <= 12; ++month)
+			lengths = lengths && (ummalqura_days_in_month(year, month) == 29 || ummalqura_days_in_month(year, month) == 30);
+	}
+	GATS_CHECK(lengths);
+#endif
+}
+
+
+
+/**	Round trips across the table and its edges, and the generic calendar facilities. */
+GATS_TEST_CASE(ut173_test_ummalqura_round_trip, ISLAMIC_CALENDAR_GROUP, 1) {
+#if PHASE_173
+	using namespace khronos;
+
+	GATS_CHECK(round_trips(UMMALQURA_TABLE.first_jdn() - 1'000, UMMALQURA_TABLE.end_jdn() + 1'000));
+
+	year_t y;
+	month_t m;
+	day_t d;
+	hour_t h;
+	minute_t mi;
+	second_t s;
+	jd_to_ummalqura(ummalqura_to_jd(1445, 9, 1, 21, 30, 15), y, m, d, h, mi, s);
+	GATS_CHECK(y == 1445 && m == 9 && d == 1 && h == 21 && mi == 30 && s == 15);
+
+	GATS_CHECK(add_days(UmmAlQura(1445, 12, 30), 1) == UmmAlQura(1446, 1, 1));
+	GATS_CHECK(add_days(UmmAlQura(1300, 1, 1), -1) == UmmAlQura(1299, 12, 29));
+	GATS_CHECK(add_months(UmmAlQura(1446, 8, 30), 1) == UmmAlQura(1446, 9, 29));
+	GATS_CHECK(add_months(UmmAlQura(1446, 9, 29), -12) == UmmAlQura(1445, 9, 29));
+	GATS_CHECK(range(UmmAlQura(1445, 1, 1), UmmAlQura(1446, 1, 1)).size() == static_cast<size_t>(2'460'499 - ummalqura_to_jdn(1445, 1, 1)));
+
+	// Stepping through a range agrees with decoding each day.
+	bool stepped = true;
+	jdn_t jdn = ummalqura_to_jdn(1440, 1, 1);
+	for (UmmAlQura const& date : range(UmmAlQura(1440, 1, 1), UmmAlQura(1450, 1, 1))) {
+		jdn_to_ummalqura(jdn++, y, m, d);
+		stepped = stepped && date == UmmAlQura(y, m, d);
+	}
+	GATS_CHECK(stepped);
+#endif
+}
+
+
+
+/**	Table files: writing, mapping and selecting. */
+GATS_TEST_CASE_SERIAL(ut174_test_ummalqura_table_file, ISLAMIC_CALENDAR_GROUP, 1) {
+#if PHASE_174
+	using namespace khronos;
+
+	string const path = (filesystem::temp_directory_path() / "ut_khronos_ummalqura.bin").string();
+	GATS_CHECK(write_ummalqura_table(path, UMMALQURA_TABLE));
+	{
+		UmmAlQuraTableFile file(path);
+		GATS_CHECK(file.is_open());
+		UmmAlQuraTable const& table = file.table();
+		GATS_CHECK(table.first_year() == 1300 && table.last_year() == 1600);
+		GATS_CHECK(ranges::equal(table.anchors(), UMMALQURA_TABLE.anchors()) && ranges::equal(table.months(), UMMALQURA_TABLE.months()));
+		GATS_CHECK(table.end_jdn() == UMMALQURA_TABLE.end_jdn());
+
+		// Selecting the mapped table, then a shorter one.
+		UmmAlQuraTableFile const moved = std::move(file);
+		GATS_CHECK(!file.is_open() && moved.is_open());
+		GATS_CHECK(set_ummalqura_table(&moved.table()) == &UMMALQURA_TABLE);
+		GATS_CHECK(&ummalqura_table() == &moved.table());
+		GATS_CHECK(ummalqura_to_jdn(1445, 9, 1) == 2'460'381);
+		set_ummalqura_table(&FIRST_BLOCK);
+		GATS_CHECK(ummalqura_to_jdn(1445, 9, 1) == islamic_to_jdn(1445, 9, 1));
+		GATS_CHECK(ummalqura_to_jdn(1301, 1, 1) == UMMALQURA_TABLE.month_start(12));
+		GATS_CHECK(set_ummalqura_table(nullptr) == &FIRST_BLOCK);
+		GATS_CHECK(&ummalqura_table() == &UMMALQURA_TABLE);
+	}
+
+	// Damaged files are refused.
+	{
+		vector<char> bytes(filesystem::file_size(path));
+		ifstream(path, ios::binary).read(bytes.data(), static_cast<streamsize>(bytes.size()));
+		bytes[16 + 80] ^= 1;	// a month of the first block, after the header and the 19 padded anchors
+		ofstream(path, ios::binary | ios::trunc).write(bytes.data(), static_cast<streamsize>(bytes.size()));
+		GATS_CHECK(!UmmAlQuraTableFile(path).is_open());
+		ofstream(path, ios::binary | ios::trunc).write(bytes.data(), 40);
+		GATS_CHECK(!UmmAlQuraTableFile(path).is_open());
+	}
+
+	// Mapped tables with arbitrary month lengths, far from the mean lunation, still decode every day.
+	mt19937_64 rng(174);
+	for (int i = 0; i < 64; ++i) {
+		RandomTable const random(rng, i % 4);
+		GATS_CHECK(random.table().valid());
+		GATS_CHECK(write_ummalqura_table(path, random.table()));
+		UmmAlQuraTableFile const file(path);
+		GATS_CHECK(file.is_open());
+		GATS_CHECK(covers(file.table()));
+	}
+	filesystem::remove(path);
+	GATS_CHECK(!UmmAlQuraTableFile(path).is_open());
+#endif
+}
+
+
+
+/**	Decodes a span of Julian Day Numbers with the built-in table. */
+GATS_BENCHMARK(ut175_bench_ummalqura_decode, ISLAMIC_CALENDAR_GROUP) {
+#if PHASE_175
+	using namespace khronos;
+
+	static jdn_t first = 2'440'000;
+	year_t y = 0;
+	month_t m = 0;
+	day_t d = 0;
+	jdn_t sum = 0;
+	for (jdn_t jdn = first; jdn < first + 36'500; ++jdn) {
+		jdn_to_ummalqura(jdn, y, m, d);
+		sum += y + m + d;
+	}
+	gats::do_not_optimize(sum);
+#endif
+}
@@ -13,6 +13,8 @@ TestApp frame declarations.
 	TestApp::TestCase::check_close_epsilon template implemenation.
 	GATS_TEST_CASE()
 	GATS_TEST_CASE_WEIGHTED()
+	GATS_TEST_CASE_SERIAL()
+	GATS_BENCHMARK()
 	GATS_CHECK()
 	GATS_CHECK_MESSAGE()
 	GATS_CHECK_EQUAL()
@@ -24,6 +26,16 @@ TestApp frame declarations.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.16
+	Added:
+		--jobs N command-line option: runs the cases on N threads
+		GATS_TEST_CASE_SERIAL() for cases that must run alone
+		GATS_BENCHMARK(), TestApp::Benchmark, gats::do_not_optimize()
+		TestApp::LogStream, serializes writes made through TestCase::log()
+	Changed:
+		TestApp::current_case() and TestApp::display() are thread-local.
+		In parallel mode each case's output is captured and printed in case order.
+
 2021-11-27
 	Added: Groups
 
@@ -67,14 +79,19 @@ the program(s) have been supplied.
 
 #include <chrono>
 #include <cstdint>
+#include <limits>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <type_traits>
 #include <vector>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 
 namespace gats {
@@ -92,6 +109,20 @@ namespace gats {
 		using ostringstream_type	= std::basic_ostringstream<char_type>;
 		using string_type			= std::basic_string<char_type>;
 
+		/*!	\brief class TestApp::LogStream
+
+			Writes to the log file while holding the log lock.  The lock is held until the end
+			of the full expression, so 'log() << a << b;' is written as a unit. */
+		class LogStream {
+			std::unique_lock<std::mutex>	lock_m;
+			ostream_type&					os_m;
+		public:
+			LogStream(std::mutex& mutex, ostream_type& os) : lock_m(mutex), os_m(os) {}
+			template <typename T>
+			LogStream& operator << (T const& value) { os_m << value; return *this; }
+			LogStream& operator << (ostream_type& (*manipulator)(ostream_type&)) { manipulator(os_m); return *this; }
+		};
+
 		/*!	\brief class TestApp::TestCase
 			
 			TestCase is the base type of classes generated by GATS_TEST_CASE().
@@ -105,8 +136,13 @@ namespace gats {
 			std::chrono::nanoseconds	elapsedTime_m{};
 			std::uintmax_t				nChecked_m = 0;
 			std::uintmax_t				nPassed_m = 0;
+			bool						ranWithoutException_m = false;
 
 			double			weight_m = 1.0;			// weighted score of this case.
+			string_type		output_m;				// output captured when run in parallel.
+
+		protected:
+			bool			serial_m = false;		// run alone, after the parallel cases (uses global state).
 
 		// VALUES
 			static const string_type	defaultGroup_csm;
@@ -124,6 +160,7 @@ namespace gats {
 
 			// Application Interface
 			virtual void execute() = 0;
+			virtual string_type summary() const { return string_type(); }	/// extra report line (empty for none).
 
 			// Check Services
 			void add_check() { ++nChecked_m; }
@@ -138,7 +175,7 @@ namespace gats {
 
 			// Parent Services
 			inline ostream_type& display() { return TestApp::display(); }
-			inline ostream_type& log() { return TestApp::logFile_m; }
+			inline LogStream log() { return LogStream(TestApp::logMutex_sm, TestApp::logFile_m); }
 
 			constexpr auto operator <=> (TestCase const& rhs) const { return name_m <=> rhs.name_m; }
 			constexpr bool operator == (TestCase const& rhs) const { return name_m == rhs.name_m; }
@@ -147,6 +184,53 @@ namespace gats {
 			friend class TestApp;
 		};
 
+		/*!	\brief class TestApp::Benchmark
+
+			Benchmark is the base type of classes generated by GATS_BENCHMARK().
+			The body is run in batches: the batch size is doubled until a batch takes at least
+			minSampleTime_csm, then warmupSamples_csm batches are discarded and samples_csm are timed.
+			A benchmark records one check, that the median time per iteration is within its limit,
+			and runs serially under --jobs so that other cases do not disturb its timing. */
+		class Benchmark : public TestCase {
+		public:
+			struct Statistics {
+				std::uintmax_t	iterations = 0;		// iterations per sample
+				std::size_t		samples = 0;
+				double			minNs = 0.0;		// times per iteration
+				double			medianNs = 0.0;
+				double			p99Ns = 0.0;
+				double			meanNs = 0.0;
+				double			stddevNs = 0.0;
+				double			opsPerSecond = 0.0;	// throughput at the median
+			};
+
+		// VALUES
+			static constexpr std::chrono::microseconds	minSampleTime_csm{ 100 };
+			static constexpr std::size_t				warmupSamples_csm = 10;
+			static constexpr std::size_t				samples_csm = 100;
+
+		// ATTRIBUTES
+		private:
+			const char*		file_m;
+			int				line_m;
+			double			maxMedianNs_m;
+			Statistics		statistics_m;
+
+		// OPERATIONS
+		public:
+			Benchmark(string_type const& name, const char* file, int line, string_type const& group,
+				double maxMedianNs = std::numeric_limits<double>::infinity(), double weight = 0.0);
+
+			void execute() override;
+			string_type summary() const override;
+			Statistics const& statistics() const { return statistics_m; }
+
+		protected:
+			virtual void run_batch(std::uintmax_t n) = 0;
+		private:
+			double time_batch(std::uintmax_t n);
+		};
+
 	// ATTRIBUTES
 	private:
 		using case_pointer_type = TestCase*;								/// will point to statically allocated test cases.
@@ -156,12 +240,19 @@ namespace gats {
 
 		static case_groups_pointer_type	casesPtr_sm;
 		static ofstream_type			logFile_m;
-		static case_pointer_type		currentCasePtr_sm;
+		static std::mutex				logMutex_sm;
+		static thread_local case_pointer_type	currentCasePtr_sm;
+		static thread_local ostream_type*		displayPtr_sm;	/// std::cout, or the running case's capture buffer.
+
+		unsigned						nJobs_m = 1;	/// threads used to run the cases (--jobs N).
 
 	// OPERATIONS
-		static ostream_type&		display() { return std::cout; }
+		static ostream_type&		display() { return *displayPtr_sm; }
 		static case_groups_type&	cases();
 
+		static void run_case(TestCase* testCase);
+		void run_cases_parallel();
+
 		// Interface
 		void setup() override;
 		int execute() override;
@@ -171,6 +262,37 @@ namespace gats {
 	};
 
 
+	namespace detail {
+		void use_char_pointer(char const volatile*);
+	}
+
+
+	/*!	\brief Keeps a value alive for a benchmark.
+
+		Forces 'value' to be materialized, so the computation producing it cannot be removed as dead code.
+		The non-const form also makes the compiler assume the value was modified, so a loop input cannot be hoisted.
+	*/
+	template <typename T>
+	inline void do_not_optimize(T const& value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+		detail::use_char_pointer(&reinterpret_cast<char const volatile&>(value));
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : : "r,m"(value) : "memory");
+#endif
+	}
+
+	template <typename T>
+	inline void do_not_optimize(T& value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+		detail::use_char_pointer(&reinterpret_cast<char const volatile&>(value));
+		_ReadWriteBarrier();
+#else
+		asm volatile("" : "+r,m"(value) : : "memory");
+#endif
+	}
+
+
 	/*!	\brief Check for value equality.
 	
 		Check for value equality, reporting if different.
@@ -242,6 +364,38 @@ namespace gats {
 	void TestCase_ ## name :: execute()
 
 
+/*!	Creates a test case with the identifier 'name' that never runs concurrently with another case.
+
+	\param 'name' is the test cases identifier.
+
+	Use for cases that change global state (e.g. the active clock source).  With --jobs N they run
+	on the main thread after all the other cases have completed.
+*/
+#define GATS_TEST_CASE_SERIAL(name, ...) \
+	static class TestCase_ ## name : public gats::TestApp::TestCase {\
+	public: TestCase_ ## name() : TestCase(#name, __VA_ARGS__) { serial_m = true; }\
+	public: virtual void execute() override;\
+	} TestCase_ ## name ## _g;\
+	void TestCase_ ## name :: execute()
+
+
+/*!	Creates a benchmark with the identifier 'name'
+
+	\param 'name' is the benchmark's identifier.
+	\param ... is the group, optionally followed by the maximum median time in ns and the weight.
+
+	The body is one iteration; pass its results to gats::do_not_optimize().  The median is
+	reported with the minimum, 99th percentile, standard deviation and throughput.
+*/
+#define GATS_BENCHMARK(name, ...) \
+	static class TestCase_ ## name : public gats::TestApp::Benchmark {\
+	public: TestCase_ ## name() : Benchmark(#name, __FILE__, __LINE__, __VA_ARGS__) { }\
+	protected: virtual void run_batch(std::uintmax_t n) override { for (; n != 0; --n) run_once(); }\
+	private: void run_once();\
+	} TestCase_ ## name ## _g;\
+	void TestCase_ ## name :: run_once()
+
+
 /*!	Creates a test case with the identifier 'name', and a percentage
 
 	\param 'name' is the test cases identifier.
@@ -22,6 +22,12 @@ TestApp framework implementations.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.16
+	Added:
+		--jobs N command-line option
+	Changed:
+		TestApp::current_case() is thread-local.
+
 Version 2021.10.29
 	Added:
 		TestApp::current_case()
@@ -57,6 +63,7 @@ the program(s) have been supplied.
 
 
 #include <gats/TestApp.hpp>
+#include <algorithm>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -64,6 +71,7 @@ the program(s) have been supplied.
 #include <functional>
 #include <filesystem>
 #include <string>
+#include <thread>
 
 
 namespace gats {
@@ -123,7 +131,9 @@ namespace gats {
 	//! Classifier instances for TestApp
 	TestApp::case_groups_pointer_type	TestApp::casesPtr_sm;
 	TestApp::ofstream_type				TestApp::logFile_m;
-	TestApp::case_pointer_type			TestApp::currentCasePtr_sm = nullptr;
+	std::mutex							TestApp::logMutex_sm;
+	thread_local TestApp::case_pointer_type	TestApp::currentCasePtr_sm = nullptr;
+	thread_local TestApp::ostream_type*		TestApp::displayPtr_sm = &std::cout;
 
 
 
@@ -151,9 +161,27 @@ namespace gats {
 	}
 
 
-	/*!	'setup' overrides the application method to register a logfile for storing test results. */
+	/*!	'setup' overrides the application method to read the options and register a logfile for storing test results.
+
+		--jobs N	run the cases on N threads (0 = one per hardware thread).
+		Other arguments are ignored.
+	*/
 	void TestApp::setup() {
 		using namespace std;
+		auto const& args = get_args();
+		for (size_t i = 1; i < args.size(); ++i) {
+			if (args[i] == "--jobs" && i + 1 < args.size()) {
+				try {
+					nJobs_m = static_cast<unsigned>(stoul(args[++i]));
+				}
+				catch (std::exception&) {
+					throw std::runtime_error("Invalid --jobs value: "s + args[i]);
+				}
+				if (nJobs_m == 0)
+					nJobs_m = std::max(1u, std::thread::hardware_concurrency());
+			}
+		}
+
 		std::filesystem::path filename = "gats-test-log-file.txt";
 		logFile_m.open(filename);
 		if (!logFile_m) {
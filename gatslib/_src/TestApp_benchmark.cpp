@@ -0,0 +1,127 @@
+/*!	\file	TestApp_benchmark.cpp
+	\brief	TestApp benchmark implementations.
+	\author	Garth Santor
+	\date	2026-10-16
+	\copyright	Garth Santor, Trinh Han
+
+=============================================================
+TestApp benchmark implementations.
+	TestApp::Benchmark class implementation.
+	gats::detail::use_char_pointer()
+
+=============================================================
+Revision History
+-------------------------------------------------------------
+
+Version 2026.10.16
+	Initial release.
+
+=============================================================
+
+Copyright Garth Santor/Trinh Han
+
+The copyright to the computer program(s) herein
+is the property of Garth Santor/Trinh Han, Canada.
+The program(s) may be used and/or copied only with
+the written permission of Garth Santor/Trinh Han
+or in accordance with the terms and conditions
+stipulated in the agreement/contract under which
+the program(s) have been supplied.
+=============================================================*/
+
+
+#include <gats/TestApp.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+using namespace std;
+using namespace std::chrono;
+
+
+namespace gats {
+	namespace detail {
+		/*!	Out-of-line sink for do_not_optimize() on compilers without GCC-style inline assembly. */
+		void use_char_pointer(char const volatile*) {}
+	}
+
+
+
+	/*!	Benchmark constructor registers the benchmark with the TestApp; benchmarks run serially. */
+	TestApp::Benchmark::Benchmark(string_type const& name, const char* file, int line, string_type const& group, double maxMedianNs, double weight)
+		: TestCase(name, group, weight), file_m(file), line_m(line), maxMedianNs_m(maxMedianNs)
+	{
+		serial_m = true;
+	}
+
+
+
+	/*!	Returns the time in nanoseconds taken to run the body n times. */
+	double TestApp::Benchmark::time_batch(std::uintmax_t n) {
+		auto start = high_resolution_clock::now();
+		run_batch(n);
+		auto stop = high_resolution_clock::now();
+		return duration<double, nano>(stop - start).count();
+	}
+
+
+
+	/*!	Calibrates the batch size, warms up, times the samples and checks the median against the limit. */
+	void TestApp::Benchmark::execute() {
+		// calibrate: the smallest power-of-two batch that takes at least the minimum sample time
+		double const minSampleNs = duration<double, nano>(minSampleTime_csm).count();
+		std::uintmax_t n = 1;
+		while (time_batch(n) < minSampleNs && n < (std::uintmax_t(1) << 40))
+			n *= 2;
+
+		for (size_t i = 0; i < warmupSamples_csm; ++i)
+			time_batch(n);
+
+		vector<double> ns(samples_csm);
+		for (auto& sample : ns)
+			sample = time_batch(n) / double(n);
+		sort(begin(ns), end(ns));
+
+		Statistics s;
+		s.iterations = n;
+		s.samples = ns.size();
+		s.minNs = ns.front();
+		s.medianNs = ns.size() % 2 ? ns[ns.size() / 2] : (ns[ns.size() / 2 - 1] + ns[ns.size() / 2]) / 2.0;
+		s.p99Ns = ns[static_cast<size_t>(ceil(0.99 * ns.size())) - 1];		// nearest rank
+		s.meanNs = accumulate(begin(ns), end(ns), 0.0) / ns.size();
+		double sumSquares = 0.0;
+		for (auto sample : ns)
+			sumSquares += (sample - s.meanNs) * (sample - s.meanNs);
+		s.stddevNs = ns.size() > 1 ? sqrt(sumSquares / (ns.size() - 1)) : 0.0;
+		s.opsPerSecond = s.medianNs > 0.0 ? 1e9 / s.medianNs : 0.0;
+		statistics_m = s;
+
+		bool const withinLimit = s.medianNs <= maxMedianNs_m;
+		string_type message;
+		if (!withinLimit) {
+			ostringstream_type oss;
+			oss << setprecision(2) << fixed << "median " << s.medianNs << " ns > limit " << maxMedianNs_m << " ns";
+			message = oss.str();
+		}
+		check_message(withinLimit, message, file_m, line_m);
+	}
+
+
+
+	/*!	Returns the benchmark's statistics as a single report line. */
+	TestApp::string_type TestApp::Benchmark::summary() const {
+		auto const& s = statistics_m;
+		ostringstream_type oss;
+		oss << setprecision(2) << fixed
+			<< "median " << s.medianNs << " ns"
+			<< "\tmin " << s.minNs << " ns"
+			<< "\tp99 " << s.p99Ns << " ns"
+			<< "\tstddev " << s.stddevNs << " ns"
+			<< "\t" << setprecision(0) << s.opsPerSecond << " ops/s"
+			<< "\t(" << s.samples << " x " << s.iterations << ")";
+		return oss.str();
+	}
+
+} // end-of-namespace gats
@@ -22,6 +22,11 @@ TestApp framework implementations.
 Revision History
 -------------------------------------------------------------
 
+Version 2026.10.16
+	Added:
+		Parallel execution of the cases on a work-stealing pool (--jobs N).
+		Benchmark statistics line in the report and log file.
+
 Version 2021.10.29
 	Added:
 		TestApp::current_case()
@@ -58,6 +63,10 @@ the program(s) have been supplied.
 
 #include <gats/TestApp.hpp>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <streambuf>
+#include <thread>
 using namespace std;
 using namespace std::chrono;
 using namespace gats::win32;
@@ -65,6 +74,163 @@ using namespace gats::win32;
 
 
 namespace gats {
+	namespace {
+		/*!	Stream buffer installed in std::cout while the cases run in parallel.
+			Output from a thread running a case goes to that case's capture buffer;
+			output from any other thread goes to the original buffer. */
+		class CaseCaptureBuffer : public std::streambuf {
+			std::streambuf* original_m;
+		public:
+			static thread_local std::streambuf* target_stm;
+
+			explicit CaseCaptureBuffer(std::streambuf* original) : original_m(original) {}
+			std::streambuf* original() const { return original_m; }
+		protected:
+			std::streambuf* destination() const { return target_stm ? target_stm : original_m; }
+			int_type overflow(int_type ch) override {
+				return traits_type::eq_int_type(ch, traits_type::eof()) ? traits_type::not_eof(ch) : destination()->sputc(traits_type::to_char_type(ch));
+			}
+			std::streamsize xsputn(char_type const* s, std::streamsize n) override { return destination()->sputn(s, n); }
+			int sync() override { return destination()->pubsync(); }
+		};
+		thread_local std::streambuf* CaseCaptureBuffer::target_stm = nullptr;
+
+
+
+		/*!	Case indices owned by one worker.  The owner takes from the front, thieves from the back. */
+		struct WorkQueue {
+			std::mutex				mutex;
+			std::deque<size_t>		items;
+
+			bool pop_front(size_t& item) {
+				lock_guard<std::mutex> lock(mutex);
+				if (items.empty()) return false;
+				item = items.front();
+				items.pop_front();
+				return true;
+			}
+			bool pop_back(size_t& item) {
+				lock_guard<std::mutex> lock(mutex);
+				if (items.empty()) return false;
+				item = items.back();
+				items.pop_back();
+				return true;
+			}
+		};
+	}
+
+
+
+	/*!	Runs a test case on the calling thread, recording its elapsed time and reporting an escaped exception. */
+	void TestApp::run_case(TestCase* testCase) {
+		currentCasePtr_sm = testCase;
+		bool ranWithoutException = false;
+		string exceptionMessage;
+		auto start = high_resolution_clock::now();
+		try {
+			testCase->execute();
+			ranWithoutException = true;
+		}
+		catch (...) {
+			exceptionMessage = "Unknown exception caught.";
+		};
+		auto stop = high_resolution_clock::now();
+		testCase->elapsedTime_m = stop - start;
+		testCase->ranWithoutException_m = ranWithoutException;
+
+		// report exception trapped
+		if (!ranWithoutException)
+			display() << testCase->name_m << ": " << exceptionMessage << endl;
+
+		currentCasePtr_sm = nullptr;
+	}
+
+
+
+	/*!	Runs the cases on nJobs_m threads.
+		The cases are dealt round-robin to per-thread queues; a thread whose queue is empty steals
+		from the back of the others.  Each case's output is captured and printed by this thread in
+		case order as soon as the case and all cases before it have finished.  Serial cases are run
+		afterwards on this thread, alone.
+	*/
+	void TestApp::run_cases_parallel() {
+		case_list_type parallelCases, serialCases;
+		for (auto& testCaseGroup : cases())
+			for (auto& testCase : testCaseGroup.second)
+				(testCase->serial_m ? serialCases : parallelCases).push_back(testCase);
+
+		size_t const nWorkers = std::min<size_t>(nJobs_m, std::max<size_t>(parallelCases.size(), 1));
+		vector<WorkQueue> queues(nWorkers);
+		for (size_t i = 0; i < parallelCases.size(); ++i)
+			queues[i % nWorkers].items.push_back(i);
+
+		std::mutex doneMutex;
+		condition_variable doneChanged;
+		vector<char> done(parallelCases.size(), false);
+
+		// take from our own queue, or steal from the others; false when all are empty.
+		auto next_case = [&](size_t self, size_t& index) {
+			if (queues[self].pop_front(index))
+				return true;
+			for (size_t k = 1; k < nWorkers; ++k)
+				if (queues[(self + k) % nWorkers].pop_back(index))
+					return true;
+			return false;
+		};
+
+		auto worker = [&](size_t self) {
+			size_t index;
+			while (next_case(self, index)) {
+				TestCase* testCase = parallelCases[index];
+				ostringstream_type captured;
+				displayPtr_sm = &captured;
+				CaseCaptureBuffer::target_stm = captured.rdbuf();
+				run_case(testCase);
+				CaseCaptureBuffer::target_stm = nullptr;
+				displayPtr_sm = &std::cout;
+				testCase->output_m = captured.str();
+
+				lock_guard<std::mutex> lock(doneMutex);
+				done[index] = true;
+				doneChanged.notify_one();
+			}
+		};
+
+		// Redirect std::cout for the duration, so that cases writing to it directly are captured too.
+		CaseCaptureBuffer captureBuffer(cout.rdbuf());
+		cout.rdbuf(&captureBuffer);
+
+		vector<thread> threads;
+		for (size_t i = 0; i < nWorkers; ++i)
+			threads.emplace_back(worker, i);
+
+		for (size_t next = 0; next < parallelCases.size(); ++next) {
+			{
+				unique_lock<std::mutex> lock(doneMutex);
+				doneChanged.wait(lock, [&] { return done[next] != 0; });
+			}
+			auto& output = parallelCases[next]->output_m;
+			if (!output.empty()) {
+				cout << bright(yellow);
+				cout << output << flush;
+				cout << white;
+				output.clear();
+			}
+		}
+
+		for (auto& t : threads)
+			t.join();
+		cout.rdbuf(captureBuffer.original());
+
+		for (auto& testCase : serialCases) {
+			cout << bright(yellow);
+			run_case(testCase);
+			cout << white;
+		}
+	}
+
+
+
 	/*!	'execute' overrides the application interface method to perform all test cases and log/report the results. */
 	int TestApp::execute() {
 
@@ -107,36 +273,21 @@ namespace gats {
 
 
 		// Run the cases
-		for (auto& testCaseGroup : cases()) {
-			for (auto& testCase : testCaseGroup.second) {
-				cout << bright(yellow);
-				currentCasePtr_sm = testCase;
-				bool ranWithoutException = false;
-				string exceptionMessage;
-				auto start = high_resolution_clock::now();
-				try {
-					testCase->execute();
-					ranWithoutException = true;
-
-					nMaxChecked = std::max(nMaxChecked, testCase->nChecked_m);
-				}
-				catch (...) {
-					exceptionMessage = "Unknown exception caught.";
-				};
-				auto stop = high_resolution_clock::now();
-				auto elapsedTime = stop - start;
-				testCase->elapsedTime_m = elapsedTime;
-
-				// report exception trapped
-				if (!ranWithoutException) {
-					cout << testCase->name_m << ": ";
-					cout << exceptionMessage << endl;
+		if (nJobs_m > 1)
+			run_cases_parallel();
+		else {
+			for (auto& testCaseGroup : cases()) {
+				for (auto& testCase : testCaseGroup.second) {
+					cout << bright(yellow);
+					run_case(testCase);
+					cout << white;
 				}
-
-				currentCasePtr_sm = nullptr;
-				cout << white;
 			}
 		}
+		for (auto& testCaseGroup : cases())
+			for (auto& testCase : testCaseGroup.second)
+				if (testCase->ranWithoutException_m)
+					nMaxChecked = std::max(nMaxChecked, testCase->nChecked_m);
 		auto nMaxCheckedDigits = (std::streamsize)floor(log10(nMaxChecked)) + 1;
 
 
@@ -208,11 +359,18 @@ namespace gats {
 				cout << endl;
 
 				// log file record
+				lock_guard<std::mutex> logLock(logMutex_sm);
 				logFile_m << std::setw(5) << std::setprecision(1) << std::fixed << ratio * testCase->weight_m;
 				logFile_m << "\t" << testCase->weight_m;
 				logFile_m << "\t" << testCase->name_m;
 				logFile_m << std::endl;
 
+				// benchmark statistics
+				if (auto summary = testCase->summary(); !summary.empty()) {
+					cout << white << "\t" << summary << endl;
+					logFile_m << "\t\t\t" << summary << std::endl;
+				}
+
 				// enumerate cases
 				nCasesPassed += passed;
 				nChecked_m += testCase->nChecked_m;
@@ -254,6 +412,7 @@ namespace gats {
 			(maxScore > 0.0 ? score*100/maxScore : 0.0) << 
 			"%)";
 		std::cout << oss.str() << std::endl;
+		lock_guard<std::mutex> logLock(logMutex_sm);
 		logFile_m << oss.str() << std::endl;
 
 		return EXIT_SUCCESS;
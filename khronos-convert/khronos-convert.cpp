@@ -0,0 +1,433 @@
+/**	@file khronos-convert.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    khronos-convert: bulk calendar conversion of a file of dates.
+
+    usage: khronos-convert --from <calendar> --to <calendar> [--threads N] <input> [<output>]
+        calendar: gregorian | julian | islamic | hebrew | jd
+
+    Input holds one date per line (commas also separate records).  Calendar dates are written
+    [-]Y-MM-DD with an optional time of day (T or space, then hh:mm[:ss[.fff]]); years are
+    astronomical and months are numbers (Hebrew: Nisan = 1 ... Veadar = 13).  JD records are
+    decimal numbers.  Output uses the same forms, one line per record and in input order; a record
+    that cannot be read, or names a day or time of day that does not exist, is written as '?'.
+    Times of day are written when the input carries one.
+
+    The input is memory mapped and cut into chunks at record boundaries.  Worker threads convert
+    the chunks into private buffers, which are written in order, so memory use is bounded by
+    threads x chunk size regardless of the input size.
+    */
+
+#include <khronos.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace khronos;
+
+
+namespace {
+
+    enum class CalendarKind { gregorian, julian, islamic, hebrew, jd, unknown };
+
+    CalendarKind calendar_from_name(std::string_view name) {
+        if (name == "gregorian") return CalendarKind::gregorian;
+        if (name == "julian") return CalendarKind::julian;
+        if (name == "islamic") return CalendarKind::islamic;
+        if (name == "hebrew") return CalendarKind::hebrew;
+        if (name == "jd") return CalendarKind::jd;
+        return CalendarKind::unknown;
+    }
+
+
+
+    // Read-only memory mapping of a whole file.
+    class MappedFile {
+        char const* data_ = nullptr;
+        std::size_t size_ = 0;
+        bool open_ = false;
+#if defined(_WIN32)
+        HANDLE file_ = INVALID_HANDLE_VALUE;
+        HANDLE mapping_ = nullptr;
+#endif
+    public:
+        explicit MappedFile(char const* path) {
+#if defined(_WIN32)
+            file_ = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+            if (file_ == INVALID_HANDLE_VALUE)
+                return;
+            LARGE_INTEGER size;
+            if (!GetFileSizeEx(file_, &size))
+                return;
+            open_ = true;
+            if (size.QuadPart == 0)
+                return;
+            mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping_ == nullptr)
+                return;
+            data_ = static_cast<char const*>(MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+            size_ = data_ ? static_cast<std::size_t>(size.QuadPart) : 0;
+            open_ = data_ != nullptr;
+#else
+            int const fd = open(path, O_RDONLY);
+            if (fd < 0)
+                return;
+            struct stat st;
+            if (fstat(fd, &st) == 0) {
+                open_ = st.st_size == 0;
+                if (st.st_size > 0) {
+                    void* p = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (p != MAP_FAILED) {
+                        madvise(p, static_cast<std::size_t>(st.st_size), MADV_SEQUENTIAL);
+                        data_ = static_cast<char const*>(p);
+                        size_ = static_cast<std::size_t>(st.st_size);
+                        open_ = true;
+                    }
+                }
+            }
+            close(fd);
+#endif
+        }
+
+        ~MappedFile() {
+#if defined(_WIN32)
+            if (data_) UnmapViewOfFile(data_);
+            if (mapping_) CloseHandle(mapping_);
+            if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+#else
+            if (data_) munmap(const_cast<char*>(data_), size_);
+#endif
+        }
+
+        MappedFile(MappedFile const&) = delete;
+        MappedFile& operator=(MappedFile const&) = delete;
+
+        bool is_open() const { return open_; }
+        std::string_view view() const { return { data_, size_ }; }
+    };
+
+
+
+    // A calendar date and time of day as read from or written to a record.
+    struct Record {
+        year_t year = 0;
+        month_t month = 1;
+        day_t day = 1;
+        hour_t hour = 0;
+        minute_t minute = 0;
+        second_t second = 0;
+        bool hasTime = false;
+    };
+
+    // Reads an integer field and advances p.
+    template <class Int>
+    bool read_int(char const*& p, char const* end, Int& value) {
+        auto const r = std::from_chars(p, end, value);
+        if (r.ec != std::errc() || r.ptr == p)
+            return false;
+        p = r.ptr;
+        return true;
+    }
+
+    // Reads [-]Y-MM-DD[(T| )hh:mm[:ss[.fff]]].
+    bool read_date(std::string_view text, Record& r) {
+        char const* p = text.data();
+        char const* const end = p + text.size();
+        if (!read_int(p, end, r.year) || p == end || *p++ != '-' || !read_int(p, end, r.month) || p == end || *p++ != '-' || !read_int(p, end, r.day))
+            return false;
+        if (p == end)
+            return true;
+        if (*p != 'T' && *p != ' ')
+            return false;
+        ++p;
+        r.hasTime = true;
+        if (!read_int(p, end, r.hour) || p == end || *p++ != ':' || !read_int(p, end, r.minute))
+            return false;
+        if (p != end && *p == ':') {
+            ++p;
+            auto const res = std::from_chars(p, end, r.second, std::chars_format::fixed);
+            if (res.ec != std::errc() || res.ptr == p)
+                return false;
+            p = res.ptr;
+        }
+        return p == end;
+    }
+
+    // True if the time of day is within 00:00:00 .. 23:59:59.999...
+    bool valid_time(Record const& r) {
+        return r.hour >= 0 && r.hour < 24 && r.minute >= 0 && r.minute < 60 && r.second >= 0 && r.second < 60;
+    }
+
+    // True if the month and day name a day of the calendar's year.
+    template <class Calendar>
+    bool valid_date(Record const& r, month_t monthsInYear) {
+        return r.month >= 1 && r.month <= monthsInYear && r.day >= 1 && r.day <= calendar_traits<Calendar>::days_in_month(r.year, r.month);
+    }
+
+    // Converts a record of the source calendar to a Julian Day.
+    bool to_jd(CalendarKind from, std::string_view text, jd_t& jd, bool& hasTime) {
+        if (from == CalendarKind::jd) {
+            hasTime = true;
+            auto const res = std::from_chars(text.data(), text.data() + text.size(), jd);
+            return res.ec == std::errc() && res.ptr == text.data() + text.size();
+        }
+
+        Record r;
+        if (!read_date(text, r) || !valid_time(r))
+            return false;
+        hasTime = r.hasTime;
+        switch (from) {
+        case CalendarKind::gregorian:
+            if (!valid_date<Gregorian>(r, 12)) return false;
+            jd = r.hasTime ? gregorian_to_jd(r.year, r.month, r.day, r.hour, r.minute, r.second) : gregorian_to_jd(r.year, r.month, r.day);
+            return true;
+        case CalendarKind::julian:
+            if (!valid_date<Julian>(r, 12)) return false;
+            jd = r.hasTime ? julian_to_jd(r.year, r.month, r.day, r.hour, r.minute, r.second) : julian_to_jd(r.year, r.month, r.day);
+            return true;
+        case CalendarKind::islamic:
+            if (!valid_date<Islamic>(r, 12)) return false;
+            jd = r.hasTime ? islamic_to_jd(r.year, r.month, r.day, r.hour, r.minute, r.second) : islamic_to_jd(r.year, r.month, r.day);
+            return true;
+        case CalendarKind::hebrew:
+            if (!valid_date<Hebrew>(r, hebrew_months_in_year(r.year))) return false;
+            jd = r.hasTime ? hebrew_to_jd(r.year, r.month, r.day, r.hour, r.minute, r.second) : hebrew_to_jd(r.year, r.month, r.day);
+            return true;
+        default:
+            return false;
+        }
+    }
+
+
+
+    // Appends formatted fields to a chunk's output buffer.
+    class Writer {
+        std::string& out_;
+    public:
+        explicit Writer(std::string& out) : out_(out) {}
+
+        void put(char c) { out_.push_back(c); }
+
+        template <class Int>
+        void put_int(Int value, int width = 0) {
+            char buffer[24];
+            char* const end = std::to_chars(buffer, buffer + sizeof(buffer), value < 0 ? -value : value).ptr;
+            if (value < 0)
+                out_.push_back('-');
+            for (auto n = end - buffer; n < width; ++n)
+                out_.push_back('0');
+            out_.append(buffer, end);
+        }
+
+        void put_jd(jd_t jd) {
+            char buffer[32];
+            out_.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), jd).ptr);
+        }
+
+        // [-]YYYY-MM-DD[Thh:mm:ss[.fff]]
+        void put_date(year_t year, month_t month, day_t day, hour_t hour, minute_t minute, second_t second, bool withTime) {
+            put_int(year, 4);
+            put('-');
+            put_int(month, 2);
+            put('-');
+            put_int(day, 2);
+            if (!withTime)
+                return;
+            long long const ms = std::min(std::llround(second * 1000.0), 59'999LL);
+            put('T');
+            put_int(hour, 2);
+            put(':');
+            put_int(minute, 2);
+            put(':');
+            put_int(ms / 1000, 2);
+            if (ms % 1000) {
+                put('.');
+                put_int(ms % 1000, 3);
+            }
+        }
+    };
+
+    // Writes a Julian Day in the target calendar.
+    void from_jd(CalendarKind to, jd_t jd, bool withTime, Writer& w) {
+        year_t year;
+        month_t month;
+        day_t day;
+        hour_t hour = 0;
+        minute_t minute = 0;
+        second_t second = 0;
+        switch (to) {
+        case CalendarKind::gregorian:
+            withTime ? jd_to_gregorian(jd, year, month, day, hour, minute, second) : jd_to_gregorian(jd, year, month, day);
+            break;
+        case CalendarKind::julian:
+            withTime ? jd_to_julian(jd, year, month, day, hour, minute, second) : jd_to_julian(jd, year, month, day);
+            break;
+        case CalendarKind::islamic:
+            withTime ? jd_to_islamic(jd, year, month, day, hour, minute, second) : jd_to_islamic(jd, year, month, day);
+            break;
+        case CalendarKind::hebrew:
+            withTime ? jd_to_hebrew(jd, year, month, day, hour, minute, second) : jd_to_hebrew(jd, year, month, day);
+            break;
+        default:
+            w.put_jd(jd);
+            return;
+        }
+        w.put_date(year, month, day, hour, minute, second, withTime);
+    }
+
+    // Converts every record of a chunk, returning the number of unreadable records.
+    std::size_t convert_chunk(std::string_view chunk, CalendarKind from, CalendarKind to, std::string& out) {
+        Writer w(out);
+        std::size_t failures = 0;
+        std::size_t pos = 0;
+        while (pos < chunk.size()) {
+            std::size_t next = chunk.find_first_of(",\n", pos);
+            if (next == std::string_view::npos)
+                next = chunk.size();
+            std::string_view record = chunk.substr(pos, next - pos);
+            pos = next + 1;
+            while (!record.empty() && (record.back() == '\r' || record.back() == ' '))
+                record.remove_suffix(1);
+            while (!record.empty() && record.front() == ' ')
+                record.remove_prefix(1);
+            if (record.empty())
+                continue;
+
+            jd_t jd;
+            bool hasTime;
+            if (to_jd(from, record, jd, hasTime))
+                from_jd(to, jd, hasTime, w);
+            else {
+                w.put('?');
+                ++failures;
+            }
+            w.put('\n');
+        }
+        return failures;
+    }
+
+    // Splits the input into chunks of about 'target' bytes that end on record boundaries.
+    std::vector<std::string_view> split(std::string_view text, std::size_t target) {
+        std::vector<std::string_view> chunks;
+        std::size_t pos = 0;
+        while (pos < text.size()) {
+            std::size_t end = std::min(text.size(), pos + target);
+            if (end < text.size()) {
+                end = text.find_first_of(",\n", end);
+                end = end == std::string_view::npos ? text.size() : end + 1;
+            }
+            chunks.push_back(text.substr(pos, end - pos));
+            pos = end;
+        }
+        return chunks;
+    }
+
+    int usage() {
+        std::fputs("usage: khronos-convert --from <calendar> --to <calendar> [--threads N] <input> [<output>]\n"
+            "       calendar: gregorian | julian | islamic | hebrew | jd\n", stderr);
+        return 2;
+    }
+}
+
+
+
+int main(int argc, char* argv[]) {
+    CalendarKind from = CalendarKind::unknown, to = CalendarKind::unknown;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    char const* inputPath = nullptr;
+    char const* outputPath = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view const arg = argv[i];
+        if (arg == "--from" && i + 1 < argc)
+            from = calendar_from_name(argv[++i]);
+        else if (arg == "--to" && i + 1 < argc)
+            to = calendar_from_name(argv[++i]);
+        else if (arg == "--threads" && i + 1 < argc)
+            threads = std::max(1, std::atoi(argv[++i]));
+        else if (!inputPath)
+            inputPath = argv[i];
+        else if (!outputPath)
+            outputPath = argv[i];
+        else
+            return usage();
+    }
+    if (from == CalendarKind::unknown || to == CalendarKind::unknown || !inputPath)
+        return usage();
+
+    MappedFile const input(inputPath);
+    if (!input.is_open()) {
+        std::fprintf(stderr, "khronos-convert: cannot read %s\n", inputPath);
+        return 1;
+    }
+    std::FILE* output = outputPath ? std::fopen(outputPath, "wb") : stdout;
+    if (!output) {
+        std::fprintf(stderr, "khronos-convert: cannot open %s\n", outputPath);
+        return 1;
+    }
+    std::setvbuf(output, nullptr, _IOFBF, 1 << 20);
+
+    // Convert a wave of chunks (one per thread) at a time, then write the wave in order.
+    constexpr std::size_t CHUNK_BYTES = 4 << 20;
+    std::vector<std::string_view> const chunks = split(input.view(), CHUNK_BYTES);
+    std::vector<std::string> buffers(threads);
+    std::atomic<std::size_t> failures{ 0 };
+    bool written = true;
+
+    for (std::size_t first = 0; written && first < chunks.size(); first += threads) {
+        std::size_t const count = std::min<std::size_t>(threads, chunks.size() - first);
+        std::atomic<std::size_t> next{ 0 };
+        auto work = [&] {
+            for (std::size_t i; (i = next.fetch_add(1)) < count;) {
+                buffers[i].clear();
+                buffers[i].reserve(chunks[first + i].size() * 2);
+                failures += convert_chunk(chunks[first + i], from, to, buffers[i]);
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (std::size_t t = 1; t < count; ++t)
+            pool.emplace_back(work);
+        work();
+        for (auto& t : pool)
+            t.join();
+
+        for (std::size_t i = 0; written && i < count; ++i)
+            written = std::fwrite(buffers[i].data(), 1, buffers[i].size(), output) == buffers[i].size();
+    }
+
+    // A full disk or a closed pipe may only show up when the buffered output is flushed.
+    written = std::fflush(output) == 0 && written;
+    if (outputPath)
+        written = std::fclose(output) == 0 && written;
+    if (!written) {
+        std::fprintf(stderr, "khronos-convert: cannot write %s: %s\n", outputPath ? outputPath : "standard output", std::strerror(errno));
+        return 1;
+    }
+
+    if (failures) {
+        std::fprintf(stderr, "khronos-convert: %zu record(s) could not be read\n", failures.load());
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,365 @@
+/**	@file khronos_bench.cpp
+    @author Garth Santor
+    @date 2026-10-16
+
+    khronos_bench: micro-benchmarks of the Khronos conversion, arithmetic and formatting functions.
+
+    usage: khronos_bench [--n N] [--repeats R] [--warmup W] [--filter text] [--json file]
+
+    Every benchmark runs over N dates drawn from each distribution:
+        modern   1900..2100 CE
+        ancient  4713 BCE..1 CE
+        random   4713 BCE..9000 CE, shuffled
+        sorted   the random dates in ascending order
+    After W warm-up passes each benchmark is timed R times.  The table on stderr and the JSON
+    report (stdout unless --json is given) give ns/op and ops/s from the median pass, plus the
+    fastest pass and the spread.
+    */
+
+#include <khronos.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace khronos;
+
+
+namespace {
+
+    // Results are folded into this sink so the optimizer cannot discard the measured work.
+    volatile std::uint64_t sink;
+
+    inline void consume(std::uint64_t value) { sink = sink + value; }
+    inline void consume(double value) { consume(static_cast<std::uint64_t>(static_cast<std::int64_t>(value * 1024.0))); }
+
+
+
+    // One distribution of input dates, pre-decoded into every calendar's fields.
+    struct Dataset {
+        std::string name;
+        std::vector<jd_t> jds;
+        std::vector<jdn_t> jdns;
+        std::vector<year_t> gy, jy, iy, hy;
+        std::vector<month_t> gm, jm, im, hm;
+        std::vector<day_t> gd, jdd, id, hd;
+        std::vector<hour_t> hours;
+        std::vector<minute_t> minutes;
+        std::vector<second_t> seconds;
+        std::vector<std::string> iso;
+    };
+
+    Dataset make_dataset(std::string name, jdn_t first, jdn_t last, std::size_t n, bool sorted, unsigned seed) {
+        Dataset ds;
+        ds.name = std::move(name);
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<jdn_t> dayDist(first, last);
+        std::uniform_int_distribution<int> secondDist(0, 86'399);
+
+        ds.jdns.resize(n);
+        for (auto& jdn : ds.jdns)
+            jdn = dayDist(rng);
+        if (sorted)
+            std::sort(ds.jdns.begin(), ds.jdns.end());
+
+        for (jdn_t const jdn : ds.jdns) {
+            int const sod = secondDist(rng);
+            ds.hours.push_back(sod / 3600);
+            ds.minutes.push_back(sod / 60 % 60);
+            ds.seconds.push_back(sod % 60);
+            ds.jds.push_back(static_cast<jd_t>(jdn) - 0.5 + sod / 86'400.0);
+
+            year_t y;
+            month_t m;
+            day_t d;
+            jdn_to_gregorian(jdn, y, m, d);
+            ds.gy.push_back(y); ds.gm.push_back(m); ds.gd.push_back(d);
+            jdn_to_julian(jdn, y, m, d);
+            ds.jy.push_back(y); ds.jm.push_back(m); ds.jdd.push_back(d);
+            jdn_to_islamic(jdn, y, m, d);
+            ds.iy.push_back(y); ds.im.push_back(m); ds.id.push_back(d);
+            jdn_to_hebrew(jdn, y, m, d);
+            ds.hy.push_back(y); ds.hm.push_back(m); ds.hd.push_back(d);
+
+            char text[48];
+            std::snprintf(text, sizeof(text), "%s%04lld-%02d-%02dT%02d:%02d:%02d", ds.gy.back() < 0 ? "-" : "",
+                std::llabs(ds.gy.back()), ds.gm.back(), ds.gd.back(), ds.hours.back(), ds.minutes.back(), static_cast<int>(ds.seconds.back()));
+            ds.iso.push_back(text);
+        }
+        return ds;
+    }
+
+
+
+    struct Benchmark {
+        char const* name;
+        std::function<void(Dataset const&)> run;   // One pass over every element of the dataset.
+    };
+
+    struct Result {
+        std::string name;
+        std::string distribution;
+        std::size_t n;
+        double minNs;       // ns/op of the fastest pass
+        double medianNs;    // ns/op of the median pass
+        double maxNs;       // ns/op of the slowest pass
+    };
+
+    std::vector<Benchmark> benchmarks() {
+        std::vector<Benchmark> b;
+
+        // Calendar -> Julian Day
+        b.push_back({ "gregorian_to_jd", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) consume(gregorian_to_jd(ds.gy[i], ds.gm[i], ds.gd[i])); } });
+        b.push_back({ "gregorian_to_jd/hms", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) consume(gregorian_to_jd(ds.gy[i], ds.gm[i], ds.gd[i], ds.hours[i], ds.minutes[i], ds.seconds[i])); } });
+        b.push_back({ "gregorian_to_jdn", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) consume(static_cast<std::uint64_t>(gregorian_to_jdn(ds.gy[i], ds.gm[i], ds.gd[i]))); } });
+        b.push_back({ "julian_to_jd", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) consume(julian_to_jd(ds.jy[i], ds.jm[i], ds.jdd[i])); } });
+        b.push_back({ "julian_to_jd/hms", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) consume(julian_to_jd(ds.jy[i], ds.jm[i], ds.jdd[i], ds.hours[i], ds.minutes[i], ds.seconds[i])); } });
+        b.push_back({ "islamic_to_jd", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) consume(islamic_to_jd(ds.iy[i], ds.im[i], ds.id[i])); } });
+        b.push_back({ "islamic_to_jd/hms", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) consume(islamic_to_jd(ds.iy[i], ds.im[i], ds.id[i], ds.hours[i], ds.minutes[i], ds.seconds[i])); } });
+        b.push_back({ "hebrew_to_jd", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) consume(hebrew_to_jd(ds.hy[i], ds.hm[i], ds.hd[i])); } });
+        b.push_back({ "hebrew_to_jd/hms", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) consume(hebrew_to_jd(ds.hy[i], ds.hm[i], ds.hd[i], ds.hours[i], ds.minutes[i], ds.seconds[i])); } });
+        b.push_back({ "batch::gregorian_to_jd", [](Dataset const& ds) {
+            static std::vector<jd_t> out;
+            out.resize(ds.jds.size());
+            batch::gregorian_to_jd(ds.gy, ds.gm, ds.gd, out);
+            consume(out.back()); } });
+
+        // Julian Day -> calendar
+        b.push_back({ "jd_to_gregorian", [](Dataset const& ds) {
+            year_t y; month_t m; day_t d;
+            for (jd_t jd : ds.jds) { jd_to_gregorian(jd, y, m, d); consume(static_cast<std::uint64_t>(y + m + d)); } } });
+        b.push_back({ "jd_to_gregorian/hms", [](Dataset const& ds) {
+            year_t y; month_t m; day_t d; hour_t h; minute_t mi; second_t s;
+            for (jd_t jd : ds.jds) { jd_to_gregorian(jd, y, m, d, h, mi, s); consume(static_cast<std::uint64_t>(y + m + d + h + mi) + s); } } });
+        b.push_back({ "jdn_to_gregorian", [](Dataset const& ds) {
+            year_t y; month_t m; day_t d;
+            for (jdn_t jdn : ds.jdns) { jdn_to_gregorian(jdn, y, m, d); consume(static_cast<std::uint64_t>(y + m + d)); } } });
+        b.push_back({ "jdn_to_gregorian_table", [](Dataset const& ds) {
+            year_t y; month_t m; day_t d;
+            for (jdn_t jdn : ds.jdns) { jdn_to_gregorian_table(jdn, y, m, d); consume(static_cast<std::uint64_t>(y + m + d)); } } });
+        b.push_back({ "jd_to_gregorian[table]", [](Dataset const& ds) {
+            year_t y; month_t m; day_t d;
+            GregorianDecoder const original = set_gregorian_decoder(GregorianDecoder::table);
+            for (jd_t jd : ds.jds) { jd_to_gregorian(jd, y, m, d); consume(static_cast<std::uint64_t>(y + m + d)); }
+            set_gregorian_decoder(original); } });
+        b.push_back({ "jd_to_julian", [](Dataset const& ds) {
+            year_t y; month_t m; day_t d;
+            for (jd_t jd : ds.jds) { jd_to_julian(jd, y, m, d); consume(static_cast<std::uint64_t>(y + m + d)); } } });
+        b.push_back({ "jd_to_julian/hms", [](Dataset const& ds) {
+            year_t y; month_t m; day_t d; hour_t h; minute_t mi; second_t s;
+            for (jd_t jd : ds.jds) { jd_to_julian(jd, y, m, d, h, mi, s); consume(static_cast<std::uint64_t>(y + m + d + h + mi) + s); } } });
+        b.push_back({ "jd_to_islamic", [](Dataset const& ds) {
+            year_t y; month_t m; day_t d;
+            for (jd_t jd : ds.jds) { jd_to_islamic(jd, y, m, d); consume(static_cast<std::uint64_t>(y + m + d)); } } });
+        b.push_back({ "jd_to_islamic/hms", [](Dataset const& ds) {
+            year_t y; month_t m; day_t d; hour_t h; minute_t mi; second_t s;
+            for (jd_t jd : ds.jds) { jd_to_islamic(jd, y, m, d, h, mi, s); consume(static_cast<std::uint64_t>(y + m + d + h + mi) + s); } } });
+        b.push_back({ "jd_to_hebrew", [](Dataset const& ds) {
+            year_t y; month_t m; day_t d;
+            for (jd_t jd : ds.jds) { jd_to_hebrew(jd, y, m, d); consume(static_cast<std::uint64_t>(y + m + d)); } } });
+        b.push_back({ "jd_to_hebrew/hms", [](Dataset const& ds) {
+            year_t y; month_t m; day_t d; hour_t h; minute_t mi; second_t s;
+            for (jd_t jd : ds.jds) { jd_to_hebrew(jd, y, m, d, h, mi, s); consume(static_cast<std::uint64_t>(y + m + d + h + mi) + s); } } });
+        b.push_back({ "batch::jd_to_gregorian", [](Dataset const& ds) {
+            static std::vector<year_t> y;
+            static std::vector<month_t> m;
+            static std::vector<day_t> d;
+            y.resize(ds.jds.size()); m.resize(ds.jds.size()); d.resize(ds.jds.size());
+            batch::jd_to_gregorian(ds.jds, y, m, d);
+            consume(static_cast<std::uint64_t>(y.back() + m.back() + d.back())); } });
+        b.push_back({ "batch::jd_to_hebrew", [](Dataset const& ds) {
+            static std::vector<year_t> y;
+            static std::vector<month_t> m;
+            static std::vector<day_t> d;
+            y.resize(ds.jds.size()); m.resize(ds.jds.size()); d.resize(ds.jds.size());
+            batch::jd_to_hebrew(ds.jds, y, m, d);
+            consume(static_cast<std::uint64_t>(y.back() + m.back() + d.back())); } });
+
+        // Calendar -> calendar
+        b.push_back({ "Julian(Jd(Gregorian))", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) {
+                Julian const j(Jd(Gregorian(ds.gy[i], ds.gm[i], ds.gd[i], ds.hours[i], ds.minutes[i], ds.seconds[i])));
+                consume(static_cast<std::uint64_t>(j.year() + j.month() + j.day()));
+            } } });
+        b.push_back({ "convert<Julian>(Gregorian)", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) {
+                Julian const j = convert<Julian>(Gregorian(ds.gy[i], ds.gm[i], ds.gd[i], ds.hours[i], ds.minutes[i], ds.seconds[i]));
+                consume(static_cast<std::uint64_t>(j.year() + j.month() + j.day()));
+            } } });
+        b.push_back({ "convert<Hebrew>(Gregorian)", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) {
+                Hebrew const h = convert<Hebrew>(Gregorian(ds.gy[i], ds.gm[i], ds.gd[i], ds.hours[i], ds.minutes[i], ds.seconds[i]));
+                consume(static_cast<std::uint64_t>(h.year() + h.month() + h.day()));
+            } } });
+
+        // Arithmetic
+        b.push_back({ "add_days(Gregorian)", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) {
+                Gregorian const g = add_days(Gregorian(ds.gy[i], ds.gm[i], ds.gd[i]), static_cast<std::int64_t>(i % 1000) - 500);
+                consume(static_cast<std::uint64_t>(g.year() + g.month() + g.day()));
+            } } });
+        b.push_back({ "add_months(Gregorian)", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) {
+                Gregorian const g = add_months(Gregorian(ds.gy[i], ds.gm[i], ds.gd[i]), static_cast<int>(i % 48) - 24);
+                consume(static_cast<std::uint64_t>(g.year() + g.month() + g.day()));
+            } } });
+        b.push_back({ "add_days(Islamic)", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) {
+                Islamic const d = add_days(Islamic(ds.iy[i], ds.im[i], ds.id[i]), static_cast<std::int64_t>(i % 1000) - 500);
+                consume(static_cast<std::uint64_t>(d.year() + d.month() + d.day()));
+            } } });
+        b.push_back({ "add_months(Islamic)", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) {
+                Islamic const d = add_months(Islamic(ds.iy[i], ds.im[i], ds.id[i]), static_cast<std::int64_t>(i % 48) - 24);
+                consume(static_cast<std::uint64_t>(d.year() + d.month() + d.day()));
+            } } });
+        b.push_back({ "Julian+months", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) {
+                Julian const d = Julian(ds.jy[i], ds.jm[i], ds.jdd[i]) + months(static_cast<month_t>(i % 48) - 24);
+                consume(static_cast<std::uint64_t>(d.year() + d.month() + d.day()));
+            } } });
+        b.push_back({ "batch::add_days", [](Dataset const& ds) {
+            static std::vector<year_t> y;
+            static std::vector<month_t> m;
+            static std::vector<day_t> d;
+            y.resize(ds.jds.size()); m.resize(ds.jds.size()); d.resize(ds.jds.size());
+            batch::add_days(ds.gy, ds.gm, ds.gd, 1000, y, m, d);
+            consume(static_cast<std::uint64_t>(y.back() + m.back() + d.back())); } });
+
+        // Day of week
+        b.push_back({ "day_of_week(Gregorian)", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) consume(static_cast<std::uint64_t>(day_of_week(Gregorian(ds.gy[i], ds.gm[i], ds.gd[i])))); } });
+        b.push_back({ "day_of_week(jd)", [](Dataset const& ds) {
+            for (jd_t jd : ds.jds) consume(static_cast<std::uint64_t>(day_of_week(jd))); } });
+
+        // Formatting and parsing
+        b.push_back({ "Jd::to_string", [](Dataset const& ds) {
+            for (jd_t jd : ds.jds) consume(static_cast<std::uint64_t>(Jd(jd).to_string().size())); } });
+        b.push_back({ "Gregorian::to_string", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i)
+                consume(static_cast<std::uint64_t>(Gregorian(ds.gy[i], ds.gm[i], ds.gd[i], ds.hours[i], ds.minutes[i], ds.seconds[i]).to_string().size())); } });
+        b.push_back({ "Julian::to_string", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) consume(static_cast<std::uint64_t>(Julian(ds.jy[i], ds.jm[i], ds.jdd[i]).to_string().size())); } });
+        b.push_back({ "Hebrew::to_string", [](Dataset const& ds) {
+            for (std::size_t i = 0; i < ds.jds.size(); ++i)
+                consume(static_cast<std::uint64_t>(Hebrew(ds.hy[i], ds.hm[i], ds.hd[i], ds.hours[i], ds.minutes[i], ds.seconds[i]).to_string().size())); } });
+        b.push_back({ "format_to(Gregorian)", [](Dataset const& ds) {
+            char buffer[FORMAT_BUFFER_SIZE];
+            for (std::size_t i = 0; i < ds.jds.size(); ++i) {
+                Gregorian const g(ds.gy[i], ds.gm[i], ds.gd[i], ds.hours[i], ds.minutes[i], ds.seconds[i]);
+                consume(static_cast<std::uint64_t>(format_to(buffer, buffer + FORMAT_BUFFER_SIZE, g) - buffer));
+            } } });
+        b.push_back({ "parse_iso8601", [](Dataset const& ds) {
+            for (auto const& text : ds.iso) consume(parse_iso8601(text).value().jd()); } });
+
+        return b;
+    }
+
+
+
+    Result measure(Benchmark const& b, Dataset const& ds, int warmup, int repeats) {
+        for (int i = 0; i < warmup; ++i)
+            b.run(ds);
+
+        std::vector<double> ns;
+        for (int i = 0; i < repeats; ++i) {
+            auto const start = std::chrono::steady_clock::now();
+            b.run(ds);
+            auto const stop = std::chrono::steady_clock::now();
+            ns.push_back(std::chrono::duration<double, std::nano>(stop - start).count() / static_cast<double>(ds.jds.size()));
+        }
+        std::sort(ns.begin(), ns.end());
+        return Result{ b.name, ds.name, ds.jds.size(), ns.front(), ns[ns.size() / 2], ns.back() };
+    }
+
+    void write_json(std::FILE* out, std::vector<Result> const& results, int warmup, int repeats) {
+        std::fprintf(out, "{\n  \"isa\": \"%s\",\n  \"warmup\": %d,\n  \"repeats\": %d,\n  \"benchmarks\": [\n",
+            batch::isa_name(batch::active_isa()), warmup, repeats);
+        for (std::size_t i = 0; i < results.size(); ++i) {
+            Result const& r = results[i];
+            std::fprintf(out, "    { \"name\": \"%s\", \"distribution\": \"%s\", \"n\": %zu, "
+                "\"ns_per_op\": %.3f, \"ns_per_op_min\": %.3f, \"ns_per_op_max\": %.3f, \"ops_per_s\": %.0f }%s\n",
+                r.name.c_str(), r.distribution.c_str(), r.n, r.medianNs, r.minNs, r.maxNs, 1e9 / r.medianNs,
+                i + 1 < results.size() ? "," : "");
+        }
+        std::fputs("  ]\n}\n", out);
+    }
+}
+
+
+
+int main(int argc, char* argv[]) {
+    std::size_t n = 1 << 16;
+    int repeats = 7;
+    int warmup = 2;
+    std::string_view filter;
+    char const* jsonPath = nullptr;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view const arg = argv[i];
+        if (arg == "--n" && i + 1 < argc)
+            n = std::max(1L, std::atol(argv[++i]));
+        else if (arg == "--repeats" && i + 1 < argc)
+            repeats = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--warmup" && i + 1 < argc)
+            warmup = std::max(0, std::atoi(argv[++i]));
+        else if (arg == "--filter" && i + 1 < argc)
+            filter = argv[++i];
+        else if (arg == "--json" && i + 1 < argc)
+            jsonPath = argv[++i];
+        else {
+            std::fputs("usage: khronos_bench [--n N] [--repeats R] [--warmup W] [--filter text] [--json file]\n", stderr);
+            return 2;
+        }
+    }
+
+    constexpr jdn_t JDN_1900 = 2'415'021;
+    constexpr jdn_t JDN_2100 = 2'488'070;
+    constexpr jdn_t JDN_1_CE = 1'721'424;
+    constexpr jdn_t JDN_9000 = 5'008'398;
+    std::vector<Dataset> const datasets = {
+        make_dataset("modern", JDN_1900, JDN_2100, n, false, 1),
+        make_dataset("ancient", 0, JDN_1_CE, n, false, 2),
+        make_dataset("random", 0, JDN_9000, n, false, 3),
+        make_dataset("sorted", 0, JDN_9000, n, true, 3),
+    };
+
+    std::vector<Result> results;
+    std::fprintf(stderr, "%-26s %-8s %12s %14s\n", "benchmark", "dist", "ns/op", "ops/s");
+    for (auto const& b : benchmarks()) {
+        if (!filter.empty() && std::string_view(b.name).find(filter) == std::string_view::npos)
+            continue;
+        for (auto const& ds : datasets) {
+            results.push_back(measure(b, ds, warmup, repeats));
+            Result const& r = results.back();
+            std::fprintf(stderr, "%-26s %-8s %12.2f %14.0f\n", r.name.c_str(), r.distribution.c_str(), r.medianNs, 1e9 / r.medianNs);
+        }
+    }
+
+    std::FILE* out = jsonPath ? std::fopen(jsonPath, "w") : stdout;
+    if (!out) {
+        std::fprintf(stderr, "khronos_bench: cannot open %s\n", jsonPath);
+        return 1;
+    }
+    write_json(out, results, warmup, repeats);
+    if (jsonPath)
+        std::fclose(out);
+    return 0;
+}